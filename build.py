@@ -102,52 +102,71 @@ class STM32ProjectBuilder:
         except ImportError as e:
             return False, f"Missing dependency: {e.name}, please run: pip install -r requirements.txt"
     
-    def build_firmware(self, target="debug"):
+    # 传感器配置档案: fixed系列把ODR/量程/灵敏度常量在编译期烧死
+    # (LSM6DSL_FIXED_CONFIG, 见 firmware/drivers/lsm6dsl.h), runtime
+    # 保留运行时可配置路径
+    SENSOR_PROFILES = {
+        'runtime': [],
+        'fixed': ['-DLSM6DSL_FIXED_CONFIG'],
+        'fixed-vibration': ['-DLSM6DSL_FIXED_CONFIG',
+                            '-DLSM6DSL_FIXED_ACCEL_ODR=LSM6DSL_XL_ODR_416_HZ',
+                            '-DLSM6DSL_FIXED_GYRO_ODR=LSM6DSL_GY_ODR_416_HZ',
+                            '-DSENSOR_USE_IMU_FIFO=1'],
+    }
+
+    def build_firmware(self, target="debug", profile="runtime"):
         """Build firmware"""
-        print(f"🔨 Building firmware (target: {target})...")
-        
+        print(f"🔨 Building firmware (target: {target}, profile: {profile})...")
+
         if not self.firmware_dir.exists():
             print("❌ Firmware directory does not exist")
             return False
-        
+
         # Check for Makefile or project files
         makefile = self.firmware_dir / "Makefile"
         project_file = list(self.firmware_dir.glob("*.project"))
-        
+
         if makefile.exists():
-            return self._build_with_make(target)
+            return self._build_with_make(target, profile)
         elif project_file:
             return self._build_with_cube_ide(project_file[0])
         else:
             print("❌ No build files found (Makefile or .project)")
             return False
-    
-    def _build_with_make(self, target):
+
+    def _build_with_make(self, target, profile="runtime"):
         """使用Makefile构建"""
         try:
             os.chdir(self.firmware_dir)
-            
+
             # 清理
             subprocess.run(['make', 'clean'], check=True)
             print("🧹 清理完成")
-            
+
             # 构建
             make_target = "all" if target == "debug" else target
-            result = subprocess.run(['make', make_target], 
+            make_cmd = ['make', make_target]
+            profile_flags = self.SENSOR_PROFILES.get(profile, [])
+            if profile_flags:
+                make_cmd.append('CFLAGS_EXTRA=' + ' '.join(profile_flags))
+            result = subprocess.run(make_cmd,
                                   capture_output=True, text=True)
             
             if result.returncode == 0:
                 print("✅ 固件构建成功")
-                
+
                 # 查找生成的二进制文件
                 bin_files = list(Path('.').glob("**/*.bin"))
                 hex_files = list(Path('.').glob("**/*.hex"))
-                
+
                 if bin_files or hex_files:
                     print("📦 生成的文件:")
                     for f in bin_files + hex_files:
                         print(f"   {f}")
-                
+
+                # SRAM2热数据布局报告 (见 firmware/src/sram2.h)
+                self._report_memory_placement()
+
                 return True
             else:
                 print(f"❌ 构建失败:\n{result.stderr}")
@@ -300,6 +319,233 @@ class STM32ProjectBuilder:
             print("❌ 功耗测试脚本未找到")
             return False
     
+    SRAM2_ORIGIN = 0x10000000
+    SRAM2_LENGTH = 32 * 1024
+
+    def _report_memory_placement(self):
+        """解析链接器map文件, 报告钉入SRAM2的热数据对象"""
+        map_files = sorted(self.firmware_dir.glob("**/*.map"),
+                           key=lambda p: p.stat().st_mtime, reverse=True)
+        if not map_files:
+            print("⚠️  未找到map文件, 跳过SRAM2布局报告")
+            return
+
+        import re
+        # GNU ld输入段行: .sram2_bss* <地址> <大小> <目标文件>
+        # 段名过长时ld会换行, 先把单独成行的段名与下一行合并
+        raw_lines = map_files[0].read_text(errors='replace').splitlines()
+        lines, pending = [], None
+        for line in raw_lines:
+            if pending is not None:
+                lines.append(pending + line)
+                pending = None
+            elif re.fullmatch(r' \.\S+', line):
+                pending = line
+            else:
+                lines.append(line)
+
+        entries = []
+        pattern = re.compile(
+            r'^\s+\.sram2_bss\S*\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)')
+        for line in lines:
+            match = pattern.match(line)
+            if not match:
+                continue
+            addr, size = int(match.group(1), 16), int(match.group(2), 16)
+            if size == 0:
+                continue
+            if not (self.SRAM2_ORIGIN <= addr <
+                    self.SRAM2_ORIGIN + self.SRAM2_LENGTH):
+                continue
+            entries.append({
+                "object": Path(match.group(3)).name,
+                "address": f"0x{addr:08x}",
+                "size": size,
+            })
+
+        if not entries:
+            print("⚠️  map文件中没有SRAM2段 - 请确认链接脚本包含")
+            print("    .sram2_bss (NOLOAD) 段 (样例见 firmware/src/sram2.h)")
+            return
+
+        total = sum(e["size"] for e in entries)
+        print(f"\n📐 SRAM2热数据布局 ({map_files[0].name}):")
+        print(f"{'object':<24} {'address':>12} {'size':>8}")
+        for e in entries:
+            print(f"{e['object']:<24} {e['address']:>12} {e['size']:>8}")
+        print(f"{'total':<24} {'':>12} {total:>8}"
+              f"  ({total * 100 // self.SRAM2_LENGTH}% of 32KB)")
+
+        self.docs_dir.mkdir(exist_ok=True)
+        report_file = self.docs_dir / "memory_report.json"
+        with open(report_file, "w") as f:
+            json.dump({
+                "region": "SRAM2",
+                "origin": f"0x{self.SRAM2_ORIGIN:08x}",
+                "length": self.SRAM2_LENGTH,
+                "used": total,
+                "entries": entries,
+            }, f, indent=2)
+        print(f"✅ SRAM2布局报告已写入 {report_file}")
+
+    def build_bench(self, flash=False, port=None, duration=60):
+        """构建(可选烧录并采集)微基准固件"""
+        print("⏱️  构建基准测试固件 (BENCH_BUILD)...")
+
+        makefile = self.firmware_dir / "Makefile"
+        if not makefile.exists():
+            print("❌ 未找到Makefile, 无法构建基准固件")
+            return False
+
+        try:
+            os.chdir(self.firmware_dir)
+
+            subprocess.run(['make', 'clean'], check=True)
+
+            # 与普通构建相同的Makefile, 仅追加BENCH_BUILD宏:
+            # 固件只创建总线引擎和基准任务, 测量在空载系统上进行
+            result = subprocess.run(['make', 'all', 'CFLAGS_EXTRA=-DBENCH_BUILD'],
+                                  capture_output=True, text=True)
+
+            if result.returncode != 0:
+                print(f"❌ 基准固件构建失败:\n{result.stderr}")
+                return False
+
+            print("✅ 基准固件构建成功")
+
+        except subprocess.CalledProcessError as e:
+            print(f"❌ 构建错误: {e}")
+            return False
+        except FileNotFoundError:
+            print("❌ make 命令未找到")
+            return False
+        finally:
+            os.chdir(self.project_root)
+
+        if flash:
+            if not self.flash_firmware():
+                return False
+
+        if port:
+            return self._capture_bench_results(port, duration)
+
+        print("ℹ️  使用 --port 采集结果: python build.py bench --flash --port COM3")
+        return True
+
+    def build_replay(self, data=None, flash=False):
+        """构建回放测试固件 (可选先从捕获文件生成数据集)"""
+        print("🔁 构建回放固件 (REPLAY_BUILD)...")
+
+        if data:
+            # 先把二进制日志捕获转换成链接进固件的数据集
+            dataset = self.firmware_dir / "src" / "replay_data.c"
+            result = subprocess.run([sys.executable,
+                                     str(self.tools_dir / "replay_capture.py"),
+                                     '--file', data, '--emit-c', str(dataset)],
+                                    capture_output=True, text=True)
+            if result.returncode != 0:
+                print(f"❌ 数据集生成失败:\n{result.stderr}")
+                return False
+            print(f"✅ 回放数据集已生成: {dataset}")
+
+        makefile = self.firmware_dir / "Makefile"
+        if not makefile.exists():
+            print("❌ 未找到Makefile, 无法构建回放固件")
+            return False
+
+        try:
+            os.chdir(self.firmware_dir)
+
+            subprocess.run(['make', 'clean'], check=True)
+
+            # 与普通构建相同的Makefile, 仅追加REPLAY_BUILD宏:
+            # 采集任务从记录数据集供数, 整条流水线以快于实时的
+            # 确定性节拍运行
+            result = subprocess.run(['make', 'all', 'CFLAGS_EXTRA=-DREPLAY_BUILD'],
+                                  capture_output=True, text=True)
+
+            if result.returncode != 0:
+                print(f"❌ 回放固件构建失败:\n{result.stderr}")
+                return False
+
+            print("✅ 回放固件构建成功")
+
+        except subprocess.CalledProcessError as e:
+            print(f"❌ 构建错误: {e}")
+            return False
+        except FileNotFoundError:
+            print("❌ make 命令未找到")
+            return False
+        finally:
+            os.chdir(self.project_root)
+
+        if flash:
+            return self.flash_firmware()
+
+        print("ℹ️  PASS记录 (样本数/台架耗时) 通过 tools/log_decoder.py 读取")
+        return True
+
+    def _capture_bench_results(self, port, duration):
+        """从UART采集BENCH结果行, 打印汇总并写入JSON供回归对比"""
+        import time
+        try:
+            import serial
+        except ImportError:
+            print("❌ 缺少pyserial, 请运行: pip install -r requirements.txt")
+            return False
+
+        print(f"📡 从 {port} 采集基准结果 (最长 {duration}s)...")
+
+        results = []
+        deadline = time.time() + duration
+        try:
+            with serial.Serial(port, 115200, timeout=1) as ser:
+                while time.time() < deadline:
+                    line = ser.readline().decode(errors='replace').strip()
+                    if line == "BENCH_END":
+                        break
+                    if not line.startswith("BENCH,"):
+                        continue
+                    # BENCH,<name>,<iters>,<min>,<avg>,<max>  (DWT cycles @80MHz)
+                    fields = line.split(',')
+                    if len(fields) != 6:
+                        continue
+                    name, iters, cyc_min, cyc_avg, cyc_max = \
+                        fields[1], int(fields[2]), int(fields[3]), \
+                        int(fields[4]), int(fields[5])
+                    results.append({
+                        "name": name,
+                        "iterations": iters,
+                        "min_cycles": cyc_min,
+                        "avg_cycles": cyc_avg,
+                        "max_cycles": cyc_max,
+                        "avg_us": round(cyc_avg / 80.0, 2),
+                    })
+        except serial.SerialException as e:
+            print(f"❌ 串口错误: {e}")
+            return False
+
+        if not results:
+            print("❌ 未采集到基准结果 (固件是否已烧录并复位?)")
+            return False
+
+        print(f"\n{'benchmark':<22} {'iters':>6} {'min':>9} {'avg':>9} "
+              f"{'max':>9} {'avg_us':>8}")
+        for r in results:
+            print(f"{r['name']:<22} {r['iterations']:>6} {r['min_cycles']:>9} "
+                  f"{r['avg_cycles']:>9} {r['max_cycles']:>9} {r['avg_us']:>8}")
+
+        self.docs_dir.mkdir(exist_ok=True)
+        output_file = self.docs_dir / "bench_results.json"
+        with open(output_file, "w") as f:
+            json.dump({
+                "cpu_clock_hz": 80000000,
+                "capture_date": subprocess.check_output(['date']).decode().strip(),
+                "results": results,
+            }, f, indent=2)
+        print(f"\n✅ {len(results)} 项基准结果已写入 {output_file}")
+        return True
+
     def install_dependencies(self):
         """安装Python依赖"""
         requirements_file = self.project_root / "requirements.txt"
@@ -398,13 +644,30 @@ def main():
     
     # 构建固件
     build_parser = subparsers.add_parser('build', help='构建固件')
-    build_parser.add_argument('--target', default='debug', 
+    build_parser.add_argument('--target', default='debug',
                             choices=['debug', 'release'], help='构建目标')
+    build_parser.add_argument('--profile', default='runtime',
+                            choices=sorted(STM32ProjectBuilder.SENSOR_PROFILES),
+                            help='传感器配置档案 (默认: runtime)')
     
     # 烧录固件
     flash_parser = subparsers.add_parser('flash', help='烧录固件')
     flash_parser.add_argument('--binary', help='二进制文件路径')
-    
+
+    # 微基准固件
+    bench_parser = subparsers.add_parser('bench', help='构建/运行微基准固件')
+    bench_parser.add_argument('--flash', action='store_true',
+                            help='构建后立即烧录')
+    bench_parser.add_argument('--port', help='采集结果的串口 (如 COM3)')
+    bench_parser.add_argument('--duration', type=int, default=60,
+                            help='采集超时秒数 (默认: 60)')
+    
+    # 回放固件
+    replay_parser = subparsers.add_parser('replay', help='构建回放测试固件')
+    replay_parser.add_argument('--data', help='二进制日志捕获文件 (先生成数据集)')
+    replay_parser.add_argument('--flash', action='store_true',
+                             help='构建后立即烧录')
+
     # 运行测试
     test_parser = subparsers.add_parser('test', help='运行测试')
     test_parser.add_argument('--type', default='all',
@@ -433,12 +696,20 @@ def main():
         sys.exit(0 if success else 1)
     
     elif args.command == 'build':
-        success = builder.build_firmware(args.target)
+        success = builder.build_firmware(args.target, args.profile)
         sys.exit(0 if success else 1)
     
     elif args.command == 'flash':
         success = builder.flash_firmware(args.binary)
         sys.exit(0 if success else 1)
+
+    elif args.command == 'bench':
+        success = builder.build_bench(args.flash, args.port, args.duration)
+        sys.exit(0 if success else 1)
+
+    elif args.command == 'replay':
+        success = builder.build_replay(args.data, args.flash)
+        sys.exit(0 if success else 1)
     
     elif args.command == 'test':
         success = builder.run_tests(args.type)
@@ -0,0 +1,621 @@
+/**
+ ******************************************************************************
+ * @file           : ism43362.c
+ * @brief          : ISM43362 eS-WiFi模块驱动实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 板载Inventek ISM43362 Wi-Fi模块的SPI驱动:
+ *                   发送路径按零拷贝设计, 上层协议直接在DMA发送bank内
+ *                   序列化报文, 驱动原地前置"S3="前缀后整包DMA出线;
+ *                   发送流水线化 - 启动DMA即返回, 模块对上一条命令的
+ *                   应答推迟到下一次发送前惰性排空, 热路径不等待逐条
+ *                   确认。控制路径(复位/入网/建连/收包)使用阻塞轮询,
+ *                   只在初始化和保活任务中调用。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ism43362.h"
+#include "sram2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* 发送bank状态 */
+typedef enum {
+  TX_BANK_FREE = 0,             // 空闲, 可被Acquire占用
+  TX_BANK_ACQUIRED,             // 上层正在序列化
+  TX_BANK_IN_FLIGHT             // DMA传输中
+} TxBankState_t;
+
+/* Private define ------------------------------------------------------------*/
+/* 末尾+2: 满载荷且总长为奇数时, 填充字节写在packet[length], 需要
+ * 预留在bank内而不是越界踩到下一个bank; 取2保持每个bank 16位对齐 */
+#define ISM43362_TX_BANK_SIZE       (ISM43362_TX_AT_PREFIX + \
+                                     ISM43362_TX_HEADROOM + \
+                                     ISM43362_TX_PAYLOAD_SIZE + 2)
+
+/* eS-WiFi协议: SPI为16位字, 奇数长度用0x0A填充 */
+#define ISM43362_PAD_BYTE           0x0A
+#define ISM43362_NAK_BYTE           0x15  // 模块应答尾部的填充字节
+
+/* Private macro -------------------------------------------------------------*/
+#define ISM43362_NSS_LOW()    HAL_GPIO_WritePin(GPIOE, ISM43362_NSS_PIN, GPIO_PIN_RESET)
+#define ISM43362_NSS_HIGH()   HAL_GPIO_WritePin(GPIOE, ISM43362_NSS_PIN, GPIO_PIN_SET)
+#define ISM43362_DATA_READY() (HAL_GPIO_ReadPin(GPIOE, ISM43362_DATARDY_PIN) == GPIO_PIN_SET)
+
+/* Private variables ---------------------------------------------------------*/
+static SPI_HandleTypeDef hspi_wifi;
+
+/* 零拷贝发送bank: 放入SRAM2, 与其他DMA缓冲区共享零等待bank */
+SRAM2_BSS static uint8_t ucTxBanks[ISM43362_TX_BANKS][ISM43362_TX_BANK_SIZE];
+static volatile uint8_t ucBankState[ISM43362_TX_BANKS];
+static volatile int8_t cDmaBank = -1;     // 在途bank索引, -1表示无
+
+/* 控制路径应答缓冲 */
+static uint8_t ucRxBuffer[ISM43362_RX_BUFFER_SIZE];
+static uint16_t usRxLength = 0;
+
+/* 上一条流水线命令的应答尚未排空 */
+static volatile uint8_t ucResponsePending = 0;
+
+/* 串行化控制路径(阻塞命令)与数据路径(DMA发送)对SPI的访问 */
+static SemaphoreHandle_t xSpiMutex = NULL;
+static StaticSemaphore_t xSpiMutexBuffer;
+
+static ISM43362Stats_t xStats = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef ISM43362_WaitReady(uint32_t timeout_ms);
+static HAL_StatusTypeDef ISM43362_ReadResponse(uint32_t timeout_ms);
+static HAL_StatusTypeDef ISM43362_Command(const char *cmd, uint32_t timeout_ms);
+static HAL_StatusTypeDef ISM43362_DrainResponse(uint32_t timeout_ms);
+static HAL_StatusTypeDef ISM43362_WaitTxIdle(uint32_t timeout_ms);
+static int8_t ISM43362_BankOf(const uint8_t *ptr);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Initialize SPI3, module GPIOs and reset the module
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  if (xSpiMutex == NULL) {
+    xSpiMutex = xSemaphoreCreateMutexStatic(&xSpiMutexBuffer);
+  }
+
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOE_CLK_ENABLE();
+  __HAL_RCC_SPI3_CLK_ENABLE();
+
+  /* SPI3引脚: PC10=SCK, PC11=MISO, PC12=MOSI */
+  GPIO_InitStruct.Pin = ISM43362_SPI_SCK_PIN | ISM43362_SPI_MISO_PIN |
+                        ISM43362_SPI_MOSI_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  GPIO_InitStruct.Alternate = GPIO_AF6_SPI3;
+  HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+
+  /* PE0=软件片选(高无效), PE8=复位(低有效) */
+  HAL_GPIO_WritePin(GPIOE, ISM43362_NSS_PIN, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(GPIOE, ISM43362_RESET_PIN, GPIO_PIN_RESET);
+  GPIO_InitStruct.Pin = ISM43362_NSS_PIN | ISM43362_RESET_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_MEDIUM;
+  HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+  /* PE1=命令/数据就绪 */
+  GPIO_InitStruct.Pin = ISM43362_DATARDY_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+  /* eS-WiFi协议为16位字SPI, 模块上限~20MHz, 80MHz/8=10MHz */
+  hspi_wifi.Instance = SPI3;
+  hspi_wifi.Init.Mode = SPI_MODE_MASTER;
+  hspi_wifi.Init.Direction = SPI_DIRECTION_2LINES;
+  hspi_wifi.Init.DataSize = SPI_DATASIZE_16BIT;
+  hspi_wifi.Init.CLKPolarity = SPI_POLARITY_LOW;
+  hspi_wifi.Init.CLKPhase = SPI_PHASE_1EDGE;
+  hspi_wifi.Init.NSS = SPI_NSS_SOFT;
+  hspi_wifi.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
+  hspi_wifi.Init.FirstBit = SPI_FIRSTBIT_MSB;
+  hspi_wifi.Init.TIMode = SPI_TIMODE_DISABLE;
+  hspi_wifi.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+  if (HAL_SPI_Init(&hspi_wifi) != HAL_OK) {
+    return HAL_ERROR;
+  }
+
+  /* 硬复位并等待模块出提示符 */
+  vTaskDelay(pdMS_TO_TICKS(ISM43362_RESET_HOLD_MS));
+  HAL_GPIO_WritePin(GPIOE, ISM43362_RESET_PIN, GPIO_PIN_SET);
+  xStats.resets++;
+
+  if (ISM43362_WaitReady(ISM43362_BOOT_TIMEOUT_MS) != HAL_OK) {
+    return HAL_TIMEOUT;
+  }
+
+  /* 读掉上电提示符 "> " */
+  return ISM43362_ReadResponse(ISM43362_BOOT_TIMEOUT_MS);
+}
+
+/**
+ * @brief  Join a WPA2 network
+ * @param  ssid: network name
+ * @param  passphrase: WPA2 passphrase
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_JoinNetwork(const char *ssid, const char *passphrase)
+{
+  char cmd[80];
+
+  snprintf(cmd, sizeof(cmd), "C1=%s\r", ssid);
+  if (ISM43362_Command(cmd, ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  snprintf(cmd, sizeof(cmd), "C2=%s\r", passphrase);
+  if (ISM43362_Command(cmd, ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  /* 安全类型4 = WPA2-AES */
+  if (ISM43362_Command("C3=4\r", ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  /* 入网 (DHCP), 可能耗时数秒 */
+  return ISM43362_Command("C0\r", ISM43362_CMD_TIMEOUT_MS);
+}
+
+/**
+ * @brief  Open a TCP client socket (socket 0)
+ * @param  host: server IPv4 address string
+ * @param  port: server TCP port
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketOpen(const char *host, uint16_t port)
+{
+  char cmd[48];
+
+  if (ISM43362_Command("P0=0\r", ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;  // 选择socket 0
+  }
+  if (ISM43362_Command("P1=0\r", ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;  // 协议0 = TCP
+  }
+  snprintf(cmd, sizeof(cmd), "P3=%s\r", host);
+  if (ISM43362_Command(cmd, ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  snprintf(cmd, sizeof(cmd), "P4=%u\r", (unsigned)port);
+  if (ISM43362_Command(cmd, ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  /* 启动TCP客户端连接 */
+  return ISM43362_Command("P6=1\r", ISM43362_CMD_TIMEOUT_MS);
+}
+
+/**
+ * @brief  Close the client socket
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketClose(void)
+{
+  return ISM43362_Command("P6=0\r", ISM43362_CMD_TIMEOUT_MS);
+}
+
+/**
+ * @brief  Acquire a free transmit bank for zero-copy serialization
+ * @param  timeout_ms: how long to wait for a bank to free up
+ * @retval Payload area pointer, NULL on timeout
+ */
+uint8_t *ISM43362_AcquireTxPayload(uint32_t timeout_ms)
+{
+  TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms);
+  uint8_t bank;
+
+  for (;;) {
+    taskENTER_CRITICAL();
+    for (bank = 0; bank < ISM43362_TX_BANKS; bank++) {
+      if (ucBankState[bank] == TX_BANK_FREE) {
+        ucBankState[bank] = TX_BANK_ACQUIRED;
+        taskEXIT_CRITICAL();
+        return &ucTxBanks[bank][ISM43362_TX_AT_PREFIX + ISM43362_TX_HEADROOM];
+      }
+    }
+    taskEXIT_CRITICAL();
+
+    if ((int32_t)(deadline - xTaskGetTickCount()) <= 0) {
+      xStats.bank_wait_timeouts++;
+      return NULL;
+    }
+    vTaskDelay(1);
+  }
+}
+
+/**
+ * @brief  Return an acquired but unsent bank to the free pool
+ * @param  payload: pointer previously returned by ISM43362_AcquireTxPayload
+ * @retval None (no-op for banks already handed to DMA)
+ */
+void ISM43362_ReleaseTxPayload(const uint8_t *payload)
+{
+  int8_t bank = ISM43362_BankOf(payload);
+
+  taskENTER_CRITICAL();
+  if (bank >= 0 && ucBankState[bank] == TX_BANK_ACQUIRED) {
+    ucBankState[bank] = TX_BANK_FREE;
+  }
+  taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief  Check whether a pointer lies inside a transmit bank
+ * @param  ptr: candidate pointer
+ * @retval 1 if the pointer belongs to a TX bank
+ */
+uint8_t ISM43362_IsTxPayload(const uint8_t *ptr)
+{
+  return (ISM43362_BankOf(ptr) >= 0) ? 1 : 0;
+}
+
+/**
+ * @brief  Transmit a packet prepared inside an acquired bank
+ * @param  packet: first byte of the packet (inside the bank headroom)
+ * @param  length: packet length in bytes
+ * @retval HAL_StatusTypeDef (HAL_OK = DMA started, not acknowledged)
+ */
+HAL_StatusTypeDef ISM43362_SendPrepared(uint8_t *packet, uint16_t length)
+{
+  char at_prefix[ISM43362_TX_AT_PREFIX];
+  uint8_t *frame_start;
+  uint16_t at_len, total;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  int8_t bank = ISM43362_BankOf(packet);
+
+  if (bank < 0 || ucBankState[bank] != TX_BANK_ACQUIRED) {
+    return HAL_ERROR;
+  }
+
+  if (xSemaphoreTake(xSpiMutex, pdMS_TO_TICKS(ISM43362_BANK_WAIT_MS)) != pdPASS) {
+    return HAL_BUSY;
+  }
+
+  do {
+    /* SPI一次只能有一笔在途传输; 10Hz发布下几乎不会等到 */
+    if (ISM43362_WaitTxIdle(ISM43362_BANK_WAIT_MS) != HAL_OK) {
+      status = HAL_BUSY;
+      break;
+    }
+
+    /* 流水线化的关键: 此处才排空上一条命令的应答, 而不是发送后等待 */
+    if (ISM43362_DrainResponse(ISM43362_BANK_WAIT_MS) != HAL_OK) {
+      break;
+    }
+
+    /* 原地前置 "S3=<len>\r" - 写在报文正前方, 整包一次DMA */
+    at_len = (uint16_t)snprintf(at_prefix, sizeof(at_prefix), "S3=%u\r",
+                                (unsigned)length);
+    frame_start = packet - at_len;
+    memcpy(frame_start, at_prefix, at_len);
+
+    total = at_len + length;
+    if (total & 1) {
+      packet[length] = ISM43362_PAD_BYTE;  // 16位SPI的奇数长度填充
+      total++;
+    }
+
+    if (ISM43362_WaitReady(ISM43362_BANK_WAIT_MS) != HAL_OK) {
+      xStats.response_timeouts++;
+      status = HAL_TIMEOUT;
+      break;
+    }
+
+    ISM43362_NSS_LOW();
+    ucBankState[bank] = TX_BANK_IN_FLIGHT;
+    cDmaBank = bank;
+    if (HAL_SPI_Transmit_DMA(&hspi_wifi, frame_start, total / 2) != HAL_OK) {
+      cDmaBank = -1;
+      ucBankState[bank] = TX_BANK_ACQUIRED;
+      ISM43362_NSS_HIGH();
+      break;
+    }
+
+    ucResponsePending = 1;
+    xStats.frames_sent++;
+    xStats.bytes_sent += length;
+    status = HAL_OK;
+  } while (0);
+
+  /* 失败时bank保持ACQUIRED, 由调用方决定重用或Release -
+   * 帧内容可能还要走离线spool路径 */
+  xSemaphoreGive(xSpiMutex);
+  return status;
+}
+
+/**
+ * @brief  Copy-path socket send for small control packets
+ * @param  data: packet bytes
+ * @param  length: packet length
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketSend(const uint8_t *data, uint16_t length)
+{
+  HAL_StatusTypeDef status;
+  uint8_t *payload;
+
+  if (length > ISM43362_TX_PAYLOAD_SIZE) {
+    return HAL_ERROR;
+  }
+  payload = ISM43362_AcquireTxPayload(ISM43362_BANK_WAIT_MS);
+  if (payload == NULL) {
+    return HAL_TIMEOUT;
+  }
+  memcpy(payload, data, length);
+  status = ISM43362_SendPrepared(payload, length);
+  if (status != HAL_OK) {
+    ISM43362_ReleaseTxPayload(payload);
+  }
+  return status;
+}
+
+/**
+ * @brief  Read pending socket data (blocking control path)
+ * @param  buffer: destination buffer
+ * @param  max_length: destination capacity
+ * @param  received: returned byte count
+ * @param  timeout_ms: total poll budget
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketReceive(uint8_t *buffer, uint16_t max_length,
+                                         uint16_t *received, uint32_t timeout_ms)
+{
+  TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms);
+  uint16_t body_length;
+
+  *received = 0;
+
+  for (;;) {
+    if (ISM43362_Command("R0\r", ISM43362_CMD_TIMEOUT_MS) != HAL_OK) {
+      return HAL_ERROR;
+    }
+
+    /* 应答格式: "\r\n<数据>\r\nOK\r\n> ", 掐头去尾取数据段 */
+    if (usRxLength > 10) {
+      body_length = usRxLength - 10;
+      if (body_length > max_length) {
+        body_length = max_length;
+      }
+      memcpy(buffer, &ucRxBuffer[2], body_length);
+      *received = body_length;
+      return HAL_OK;
+    }
+
+    if ((int32_t)(deadline - xTaskGetTickCount()) <= 0) {
+      return HAL_TIMEOUT;
+    }
+    vTaskDelay(pdMS_TO_TICKS(50));
+  }
+}
+
+/**
+ * @brief  Check whether a zero-copy transfer is still on the wire
+ * @retval 1 if a DMA transfer is in flight
+ */
+uint8_t ISM43362_TxInFlight(void)
+{
+  return (cDmaBank >= 0) ? 1 : 0;
+}
+
+/**
+ * @brief  Get driver statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void ISM43362_GetStats(ISM43362Stats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xStats, sizeof(ISM43362Stats_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+/**
+ * @brief  等待模块命令/数据就绪引脚置位
+ * @param  timeout_ms: 超时
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef ISM43362_WaitReady(uint32_t timeout_ms)
+{
+  TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms);
+
+  while (!ISM43362_DATA_READY()) {
+    if ((int32_t)(deadline - xTaskGetTickCount()) <= 0) {
+      return HAL_TIMEOUT;
+    }
+    vTaskDelay(1);
+  }
+  return HAL_OK;
+}
+
+/**
+ * @brief  等待在途DMA传输结束
+ * @param  timeout_ms: 超时
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef ISM43362_WaitTxIdle(uint32_t timeout_ms)
+{
+  TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms);
+
+  while (cDmaBank >= 0) {
+    if ((int32_t)(deadline - xTaskGetTickCount()) <= 0) {
+      return HAL_TIMEOUT;
+    }
+    vTaskDelay(1);
+  }
+  return HAL_OK;
+}
+
+/**
+ * @brief  读取模块应答到ucRxBuffer (就绪引脚拉低即结束)
+ * @param  timeout_ms: 等待应答就绪的超时
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef ISM43362_ReadResponse(uint32_t timeout_ms)
+{
+  uint8_t filler[2] = {ISM43362_PAD_BYTE, ISM43362_PAD_BYTE};
+  uint8_t word[2];
+
+  if (ISM43362_WaitReady(timeout_ms) != HAL_OK) {
+    xStats.response_timeouts++;
+    return HAL_TIMEOUT;
+  }
+
+  usRxLength = 0;
+  ISM43362_NSS_LOW();
+  /* 每轮追加2字节, 且末尾要留1字节给命令路径写'\0', 故上界取严格小于 */
+  while (ISM43362_DATA_READY() &&
+         usRxLength < ISM43362_RX_BUFFER_SIZE - 2) {
+    if (HAL_SPI_TransmitReceive(&hspi_wifi, filler, word, 1, 10) != HAL_OK) {
+      break;
+    }
+    ucRxBuffer[usRxLength++] = word[0];
+    ucRxBuffer[usRxLength++] = word[1];
+  }
+  ISM43362_NSS_HIGH();
+
+  /* 去掉尾部的NAK填充字节 */
+  while (usRxLength > 0 && ucRxBuffer[usRxLength - 1] == ISM43362_NAK_BYTE) {
+    usRxLength--;
+  }
+
+  if (usRxLength >= 2 &&
+      memcmp(&ucRxBuffer[usRxLength - 2], "> ", 2) == 0) {
+    return HAL_OK;
+  }
+  xStats.response_errors++;
+  return HAL_ERROR;
+}
+
+/**
+ * @brief  发送一条AT命令并等待完整应答 (阻塞, 仅控制路径)
+ * @param  cmd: 以'\r'结尾的命令串
+ * @param  timeout_ms: 应答超时
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef ISM43362_Command(const char *cmd, uint32_t timeout_ms)
+{
+  uint8_t tx[64];
+  uint16_t len = (uint16_t)strlen(cmd);
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if (len >= sizeof(tx)) {
+    return HAL_ERROR;
+  }
+  if (xSemaphoreTake(xSpiMutex, pdMS_TO_TICKS(timeout_ms)) != pdPASS) {
+    return HAL_BUSY;
+  }
+
+  do {
+    /* 数据路径的在途DMA与未排空应答必须先清掉 */
+    if (ISM43362_WaitTxIdle(timeout_ms) != HAL_OK) {
+      status = HAL_BUSY;
+      break;
+    }
+    if (ISM43362_DrainResponse(timeout_ms) != HAL_OK) {
+      break;
+    }
+    if (ISM43362_WaitReady(timeout_ms) != HAL_OK) {
+      xStats.response_timeouts++;
+      status = HAL_TIMEOUT;
+      break;
+    }
+
+    memcpy(tx, cmd, len);
+    if (len & 1) {
+      tx[len++] = ISM43362_PAD_BYTE;
+    }
+
+    ISM43362_NSS_LOW();
+    if (HAL_SPI_Transmit(&hspi_wifi, tx, len / 2, 100) != HAL_OK) {
+      ISM43362_NSS_HIGH();
+      break;
+    }
+    ISM43362_NSS_HIGH();
+    xStats.commands_sent++;
+
+    if (ISM43362_ReadResponse(timeout_ms) != HAL_OK) {
+      break;
+    }
+
+    /* 应答里必须有OK, 否则模块报错 */
+    ucRxBuffer[usRxLength] = '\0';
+    if (strstr((char *)ucRxBuffer, "OK") == NULL) {
+      xStats.response_errors++;
+      break;
+    }
+    status = HAL_OK;
+  } while (0);
+
+  xSemaphoreGive(xSpiMutex);
+  return status;
+}
+
+/**
+ * @brief  惰性排空上一条流水线命令的应答
+ * @param  timeout_ms: 超时
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef ISM43362_DrainResponse(uint32_t timeout_ms)
+{
+  HAL_StatusTypeDef status;
+
+  if (!ucResponsePending) {
+    return HAL_OK;
+  }
+  status = ISM43362_ReadResponse(timeout_ms);
+  ucResponsePending = 0;
+  return status;
+}
+
+/**
+ * @brief  根据指针定位所属发送bank
+ * @param  ptr: 报文内任意位置指针
+ * @retval bank索引, 不在任何bank内返回-1
+ */
+static int8_t ISM43362_BankOf(const uint8_t *ptr)
+{
+  int8_t bank;
+
+  for (bank = 0; bank < ISM43362_TX_BANKS; bank++) {
+    if (ptr >= ucTxBanks[bank] &&
+        ptr < ucTxBanks[bank] + ISM43362_TX_BANK_SIZE) {
+      return bank;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief  SPI发送DMA完成回调: 释放片选与在途bank
+ * @param  hspi: SPI句柄
+ * @retval None
+ */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  if (hspi == &hspi_wifi && cDmaBank >= 0) {
+    ISM43362_NSS_HIGH();
+    ucBankState[cDmaBank] = TX_BANK_FREE;
+    cDmaBank = -1;
+  }
+}
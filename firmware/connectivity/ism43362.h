@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @file           : ism43362.h
+ * @brief          : ISM43362 eS-WiFi module driver header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : SPI driver for the on-board Inventek ISM43362 Wi-Fi
+ *                   module (AT command set over SPI3) built around a
+ *                   zero-copy transmit path
+ *                  - The driver owns two DMA transmit banks; producers
+ *                    acquire a bank and serialize their packet directly
+ *                    into it, so application payloads are never copied on
+ *                    the way to the wire
+ *                  - Each bank keeps ISM43362_TX_HEADROOM bytes of slack in
+ *                    front of the payload area so protocol layers (MQTT)
+ *                    can prepend their headers in place; the driver adds
+ *                    the eS-WiFi "S3=<len>\r" prefix the same way
+ *                  - Sends are pipelined: ISM43362_SendPrepared starts the
+ *                    DMA transfer and returns, and the module's command
+ *                    response is drained lazily before the NEXT transfer
+ *                    instead of being awaited per message
+ *                  - Blocking polled transfers are used only on the control
+ *                    path (reset, network join, socket setup, receive)
+ ******************************************************************************
+ */
+
+#ifndef __ISM43362_H
+#define __ISM43362_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Driver statistics */
+typedef struct {
+  uint32_t commands_sent;       // Control-path AT commands issued
+  uint32_t frames_sent;         // Zero-copy data transfers started
+  uint32_t bytes_sent;          // Payload bytes handed to DMA
+  uint32_t bank_wait_timeouts;  // No free TX bank within the wait bound
+  uint32_t response_timeouts;   // Module failed to answer in time
+  uint32_t response_errors;     // Module answered with an error
+  uint32_t resets;              // Hardware reset cycles performed
+} ISM43362Stats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* B-L475E-IOT01A wiring: SPI3 on PC10/PC11/PC12, module control on port E */
+#define ISM43362_SPI_SCK_PIN        GPIO_PIN_10   // PC10 AF6
+#define ISM43362_SPI_MISO_PIN       GPIO_PIN_11   // PC11 AF6
+#define ISM43362_SPI_MOSI_PIN       GPIO_PIN_12   // PC12 AF6
+#define ISM43362_NSS_PIN            GPIO_PIN_0    // PE0, software chip select
+#define ISM43362_DATARDY_PIN        GPIO_PIN_1    // PE1, command/data ready
+#define ISM43362_RESET_PIN          GPIO_PIN_8    // PE8, active low
+
+/* Zero-copy transmit banks: headroom for protocol headers plus the
+ * eS-WiFi AT prefix, payload area sized for one telemetry frame with
+ * margin. Two banks let the next frame be encoded while the previous
+ * transfer is still on the wire. */
+#define ISM43362_TX_BANKS           2
+#define ISM43362_TX_AT_PREFIX       16    // "S3=<len>\r" scratch
+#define ISM43362_TX_HEADROOM        48    // Protocol header slack (MQTT)
+#define ISM43362_TX_PAYLOAD_SIZE    256
+
+/* Control-path timing */
+#define ISM43362_RESET_HOLD_MS      10
+#define ISM43362_BOOT_TIMEOUT_MS    500
+#define ISM43362_CMD_TIMEOUT_MS     5000  // Network join can be slow
+#define ISM43362_BANK_WAIT_MS       20    // Bound on waiting for a free bank
+
+/* Control-path response buffer (AT replies, received socket data) */
+#define ISM43362_RX_BUFFER_SIZE     512
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize SPI3, module GPIOs and reset the module
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_Init(void);
+
+/**
+ * @brief  Join a WPA2 network
+ * @param  ssid: network name
+ * @param  passphrase: WPA2 passphrase
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_JoinNetwork(const char *ssid, const char *passphrase);
+
+/**
+ * @brief  Open a TCP client socket (socket 0)
+ * @param  host: server IPv4 address string
+ * @param  port: server TCP port
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketOpen(const char *host, uint16_t port);
+
+/**
+ * @brief  Close the client socket
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketClose(void);
+
+/**
+ * @brief  Acquire a free transmit bank for zero-copy serialization
+ * @param  timeout_ms: how long to wait for a bank to free up
+ * @retval Pointer to the payload area (ISM43362_TX_PAYLOAD_SIZE bytes,
+ *         with ISM43362_TX_HEADROOM writable bytes in front), NULL on
+ *         timeout
+ */
+uint8_t *ISM43362_AcquireTxPayload(uint32_t timeout_ms);
+
+/**
+ * @brief  Return an acquired but unsent bank to the free pool
+ * @param  payload: pointer previously returned by ISM43362_AcquireTxPayload
+ * @retval None (no-op for banks already handed to DMA)
+ */
+void ISM43362_ReleaseTxPayload(const uint8_t *payload);
+
+/**
+ * @brief  Check whether a pointer lies inside a transmit bank
+ * @param  ptr: candidate pointer
+ * @retval 1 if the pointer belongs to a TX bank
+ */
+uint8_t ISM43362_IsTxPayload(const uint8_t *ptr);
+
+/**
+ * @brief  Transmit a packet prepared inside an acquired bank
+ * @param  packet: first byte of the packet; may point up to
+ *         ISM43362_TX_HEADROOM bytes before the acquired payload pointer
+ * @param  length: packet length in bytes
+ * @retval HAL_StatusTypeDef (HAL_OK = DMA started, not acknowledged)
+ */
+HAL_StatusTypeDef ISM43362_SendPrepared(uint8_t *packet, uint16_t length);
+
+/**
+ * @brief  Copy-path socket send for small control packets
+ * @param  data: packet bytes
+ * @param  length: packet length
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketSend(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief  Read pending socket data (blocking control path)
+ * @param  buffer: destination buffer
+ * @param  max_length: destination capacity
+ * @param  received: returned byte count
+ * @param  timeout_ms: total poll budget
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef ISM43362_SocketReceive(uint8_t *buffer, uint16_t max_length,
+                                         uint16_t *received, uint32_t timeout_ms);
+
+/**
+ * @brief  Check whether a zero-copy transfer is still on the wire
+ * @retval 1 if a DMA transfer is in flight
+ */
+uint8_t ISM43362_TxInFlight(void);
+
+/**
+ * @brief  Get driver statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void ISM43362_GetStats(ISM43362Stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ISM43362_H */
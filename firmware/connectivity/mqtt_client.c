@@ -0,0 +1,314 @@
+/**
+ ******************************************************************************
+ * @file           : mqtt_client.c
+ * @brief          : 流水线化MQTT 3.1.1遥测发布客户端实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 遥测链路的MQTT传输层:
+ *                   覆盖telemetry.c的弱传输钩子, 遥测任务直接在ISM43362
+ *                   DMA bank内编码帧, PUBLISH报头原地前置 - 帧从编码到
+ *                   出线只写一次, 零拷贝。发布为QoS0流水线, 热路径既不
+ *                   等broker确认也不等模块应答; 入网/CONNECT握手/PINGREQ
+ *                   保活/断链重连全部在低优先级连接任务中完成。链路断开
+ *                   时传输钩子快速失败, 帧走既有的telem_spool离线缓冲。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mqtt_client.h"
+#include "ism43362.h"
+#include "telemetry.h"
+#include "profiling.h"
+#include "latency.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define MQTT_TASK_STACK_SIZE        TASK_STACK_SIZE_MQTT
+#define MQTT_TASK_PRIORITY          TASK_PRIORITY_MQTT
+
+/* MQTT 3.1.1报文类型 (高4位) */
+#define MQTT_PKT_CONNECT            0x10
+#define MQTT_PKT_CONNACK            0x20
+#define MQTT_PKT_PUBLISH            0x30
+#define MQTT_PKT_PINGREQ            0xC0
+
+/* 保活窗口一半没有发布流量才发PINGREQ; 正常10Hz发布下永远不触发 */
+#define MQTT_PING_IDLE_MS           ((MQTT_KEEPALIVE_S * 1000) / 2)
+
+/* 连接任务的巡检周期 */
+#define MQTT_POLL_PERIOD_MS         1000
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static TaskHandle_t xMqttTaskHandle = NULL;
+static StaticTask_t xMqttTaskTCB;
+static StackType_t xMqttTaskStack[MQTT_TASK_STACK_SIZE];
+
+static volatile uint8_t ucConnected = 0;
+static volatile TickType_t xLastActivityTick = 0;
+
+static MQTTStats_t xMqttStats = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+static void MqttTask(void *pvParameters);
+static HAL_StatusTypeDef MQTT_BringUp(void);
+static HAL_StatusTypeDef MQTT_SendConnect(void);
+static uint8_t *MQTT_BuildPublishHeader(uint8_t *payload, uint16_t payload_length,
+                                        uint16_t *header_length);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Create the MQTT connection management task
+ * @retval BaseType_t
+ */
+BaseType_t MQTT_CreateTask(void)
+{
+  xMqttTaskHandle = xTaskCreateStatic(MqttTask, "MQTT",
+                                      MQTT_TASK_STACK_SIZE, NULL,
+                                      MQTT_TASK_PRIORITY,
+                                      xMqttTaskStack, &xMqttTaskTCB);
+  return (xMqttTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  Check whether the broker connection is up
+ * @retval 1 if connected
+ */
+uint8_t MQTT_IsConnected(void)
+{
+  return ucConnected;
+}
+
+/**
+ * @brief  Get client statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void MQTT_GetStats(MQTTStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xMqttStats, sizeof(MQTTStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+/**
+ * @brief  连接管理任务: 入网/握手/保活/重连, 全程不在发布热路径上
+ * @param  pvParameters: 任务参数
+ * @retval None
+ */
+static void MqttTask(void *pvParameters)
+{
+  static const uint8_t pingreq[2] = {MQTT_PKT_PINGREQ, 0x00};
+  uint8_t module_ready = 0;
+
+  for (;;) {
+    if (!ucConnected) {
+      if (!module_ready) {
+        module_ready = (ISM43362_Init() == HAL_OK) ? 1 : 0;
+      }
+      if (module_ready && MQTT_BringUp() == HAL_OK) {
+        ucConnected = 1;
+        xLastActivityTick = xTaskGetTickCount();
+        xMqttStats.connects++;
+        continue;
+      }
+      xMqttStats.connect_failures++;
+      vTaskDelay(pdMS_TO_TICKS(MQTT_RECONNECT_DELAY_MS));
+      continue;
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(MQTT_POLL_PERIOD_MS));
+
+    /* 发布流量本身就是保活; 只有链路空闲过半个保活窗口才补PINGREQ.
+     * PINGRESP不等待 - QoS0流水线下断链由下一次发送失败暴露 */
+    if ((xTaskGetTickCount() - xLastActivityTick) >= pdMS_TO_TICKS(MQTT_PING_IDLE_MS)) {
+      if (ISM43362_SocketSend(pingreq, sizeof(pingreq)) == HAL_OK) {
+        xMqttStats.pings++;
+        xLastActivityTick = xTaskGetTickCount();
+      } else {
+        /* 保活发不出去: 判定断链, 走重连流程 */
+        ucConnected = 0;
+        xMqttStats.reconnects++;
+        ISM43362_SocketClose();
+      }
+    }
+  }
+}
+
+/**
+ * @brief  建立到broker的完整连接: TCP socket + CONNECT/CONNACK握手
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef MQTT_BringUp(void)
+{
+  uint8_t connack[4];
+  uint16_t received;
+
+  if (ISM43362_JoinNetwork(WIFI_SSID, WIFI_PASSPHRASE) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  if (ISM43362_SocketOpen(MQTT_BROKER_HOST, MQTT_BROKER_PORT) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  if (MQTT_SendConnect() != HAL_OK) {
+    ISM43362_SocketClose();
+    return HAL_ERROR;
+  }
+
+  /* CONNACK是全程唯一等待的确认: 0x20 0x02 <flags> <return code 0> */
+  if (ISM43362_SocketReceive(connack, sizeof(connack), &received,
+                             MQTT_CONNECT_TIMEOUT_MS) != HAL_OK ||
+      received < 4 || connack[0] != MQTT_PKT_CONNACK || connack[3] != 0x00) {
+    ISM43362_SocketClose();
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+ * @brief  发送MQTT CONNECT报文 (clean session, 无遗嘱/认证)
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef MQTT_SendConnect(void)
+{
+  uint8_t packet[14 + sizeof(MQTT_CLIENT_ID)];
+  uint16_t id_length = (uint16_t)(sizeof(MQTT_CLIENT_ID) - 1);
+  uint16_t pos = 0;
+
+  packet[pos++] = MQTT_PKT_CONNECT;
+  packet[pos++] = (uint8_t)(10 + 2 + id_length);  // remaining length
+  packet[pos++] = 0x00;                           // protocol name "MQTT"
+  packet[pos++] = 0x04;
+  packet[pos++] = 'M';
+  packet[pos++] = 'Q';
+  packet[pos++] = 'T';
+  packet[pos++] = 'T';
+  packet[pos++] = 0x04;                           // protocol level 3.1.1
+  packet[pos++] = 0x02;                           // clean session
+  packet[pos++] = (uint8_t)(MQTT_KEEPALIVE_S >> 8);
+  packet[pos++] = (uint8_t)(MQTT_KEEPALIVE_S & 0xFF);
+  packet[pos++] = (uint8_t)(id_length >> 8);
+  packet[pos++] = (uint8_t)(id_length & 0xFF);
+  memcpy(&packet[pos], MQTT_CLIENT_ID, id_length);
+  pos += id_length;
+
+  return ISM43362_SocketSend(packet, pos);
+}
+
+/**
+ * @brief  在载荷正前方原地构造PUBLISH报头 (QoS0)
+ * @param  payload: DMA bank内的载荷首地址
+ * @param  payload_length: 载荷长度
+ * @param  header_length: 返回的报头长度
+ * @retval 报文首地址 (payload - *header_length)
+ */
+static uint8_t *MQTT_BuildPublishHeader(uint8_t *payload, uint16_t payload_length,
+                                        uint16_t *header_length)
+{
+  uint16_t topic_length = (uint16_t)(sizeof(MQTT_TOPIC_TELEMETRY) - 1);
+  uint32_t remaining = (uint32_t)2 + topic_length + payload_length;
+  uint8_t *p = payload;
+
+  /* 从载荷往前倒着写: 主题 -> 主题长度 -> 剩余长度varint -> 报文类型 */
+  p -= topic_length;
+  memcpy(p, MQTT_TOPIC_TELEMETRY, topic_length);
+  p -= 2;
+  p[0] = (uint8_t)(topic_length >> 8);
+  p[1] = (uint8_t)(topic_length & 0xFF);
+
+  if (remaining > 127) {
+    p -= 2;
+    p[0] = (uint8_t)((remaining & 0x7F) | 0x80);
+    p[1] = (uint8_t)(remaining >> 7);
+  } else {
+    p -= 1;
+    p[0] = (uint8_t)remaining;
+  }
+  p -= 1;
+  p[0] = MQTT_PKT_PUBLISH;
+
+  *header_length = (uint16_t)(payload - p);
+  return p;
+}
+
+/**
+ * @brief  遥测帧缓冲钩子的强实现: 把帧编码引到DMA bank里
+ * @retval 载荷区指针, 链路未就绪或bank耗尽时返回NULL (遥测任务
+ *         退回内部缓冲 + 离线spool路径)
+ */
+uint8_t *Telemetry_TransportFrameBuffer(void)
+{
+  if (!ucConnected) {
+    return NULL;
+  }
+  return ISM43362_AcquireTxPayload(ISM43362_BANK_WAIT_MS);
+}
+
+/**
+ * @brief  帧释放钩子的强实现: 未能出线的bank归还空闲池
+ * @param  frame: 帧首地址
+ * @retval None
+ */
+void Telemetry_TransportFrameRelease(const uint8_t *frame)
+{
+  if (ISM43362_IsTxPayload(frame)) {
+    ISM43362_ReleaseTxPayload(frame);
+  }
+}
+
+/**
+ * @brief  传输钩子的强实现: 零拷贝流水线PUBLISH
+ * @param  frame: 编码后的帧 (通常已在DMA bank内)
+ * @param  length: 帧长度
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Telemetry_TransportPublish(const uint8_t *frame, uint16_t length)
+{
+  uint32_t stage_start_cycles = Profiling_GetCycles();
+  uint8_t *payload, *packet;
+  uint16_t header_length;
+  uint8_t spool_copy = 0;
+  HAL_StatusTypeDef status;
+
+  if (!ucConnected) {
+    return HAL_ERROR;
+  }
+
+  if (ISM43362_IsTxPayload(frame)) {
+    /* 零拷贝主路径: 帧已在bank里, 报头原地前置 */
+    payload = (uint8_t *)frame;
+  } else {
+    spool_copy = 1;
+    /* spool回放路径: 帧来自闪存缓冲, 复制进一个空闲bank */
+    payload = ISM43362_AcquireTxPayload(ISM43362_BANK_WAIT_MS);
+    if (payload == NULL) {
+      xMqttStats.publish_failures++;
+      return HAL_BUSY;
+    }
+    memcpy(payload, frame, length);
+  }
+
+  packet = MQTT_BuildPublishHeader(payload, length, &header_length);
+  status = ISM43362_SendPrepared(packet, (uint16_t)(header_length + length));
+
+  if (status == HAL_OK) {
+    xMqttStats.publishes++;
+    xLastActivityTick = xTaskGetTickCount();
+    /* 发布阶段延迟: 帧交付到DMA启动 (流水线下即热路径全部开销) */
+    Latency_Record(LAT_STAGE_PUBLISH, stage_start_cycles);
+  } else {
+    xMqttStats.publish_failures++;
+    if (spool_copy) {
+      ISM43362_ReleaseTxPayload(payload);
+    }
+  }
+  return status;
+}
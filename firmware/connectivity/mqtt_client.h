@@ -0,0 +1,104 @@
+/**
+ ******************************************************************************
+ * @file           : mqtt_client.h
+ * @brief          : Pipelined MQTT 3.1.1 telemetry publisher header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Minimal MQTT 3.1.1 client on top of the ISM43362
+ *                   zero-copy socket, built for the telemetry publish rate
+ *                  - Overrides the weak Telemetry_TransportFrameBuffer /
+ *                    Telemetry_TransportPublish hooks: the telemetry task
+ *                    encodes each frame directly into an ISM43362 DMA bank
+ *                    and the PUBLISH header is prepended in place - the
+ *                    frame is written exactly once on its way to the wire
+ *                  - Publishes are QoS0 and pipelined; the hot path never
+ *                    waits for broker or module acknowledgements
+ *                  - Connection management (Wi-Fi join, CONNECT/CONNACK,
+ *                    PINGREQ keepalive, reconnect) lives in a low-priority
+ *                    task, completely off the publish path
+ *                  - While the link is down the transport hook fails fast
+ *                    and frames take the existing telem_spool detour
+ ******************************************************************************
+ */
+
+#ifndef __MQTT_CLIENT_H
+#define __MQTT_CLIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Client statistics */
+typedef struct {
+  uint32_t connects;            // Successful CONNECT/CONNACK handshakes
+  uint32_t connect_failures;    // Join/socket/handshake failures
+  uint32_t publishes;           // PUBLISH packets handed to DMA
+  uint32_t publish_failures;    // Transport rejected a frame
+  uint32_t pings;               // PINGREQ keepalives sent
+  uint32_t reconnects;          // Link drops that triggered a reconnect
+} MQTTStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Deployment configuration - override from the build when needed */
+#ifndef WIFI_SSID
+#define WIFI_SSID                   "iot-telemetry"
+#endif
+#ifndef WIFI_PASSPHRASE
+#define WIFI_PASSPHRASE             "changeme"
+#endif
+#ifndef MQTT_BROKER_HOST
+#define MQTT_BROKER_HOST            "192.168.1.100"
+#endif
+#ifndef MQTT_BROKER_PORT
+#define MQTT_BROKER_PORT            1883
+#endif
+
+#define MQTT_CLIENT_ID              "stm32l475-telem"
+#define MQTT_TOPIC_TELEMETRY        "sensors/telemetry"
+
+/* Keepalive interval; PINGREQ is only sent when no PUBLISH went out
+ * within the window, from the connection task */
+#define MQTT_KEEPALIVE_S            60
+#define MQTT_CONNECT_TIMEOUT_MS     5000
+#define MQTT_RECONNECT_DELAY_MS     5000
+
+/* Worst-case PUBLISH header: fixed header (1+2 varint) + topic length
+ * field + topic - must fit the ISM43362 bank headroom */
+#define MQTT_PUBLISH_HEADER_MAX     (3 + 2 + sizeof(MQTT_TOPIC_TELEMETRY) - 1)
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the MQTT connection management task
+ * @retval BaseType_t
+ */
+BaseType_t MQTT_CreateTask(void);
+
+/**
+ * @brief  Check whether the broker connection is up
+ * @retval 1 if connected
+ */
+uint8_t MQTT_IsConnected(void);
+
+/**
+ * @brief  Get client statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void MQTT_GetStats(MQTTStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MQTT_CLIENT_H */
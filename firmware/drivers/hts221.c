@@ -0,0 +1,210 @@
+/**
+ ******************************************************************************
+ * @file           : hts221.c
+ * @brief          : HTS221湿度传感器驱动程序实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hts221.h"
+#include "sram2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* 出厂标定参数 (初始化时一次性读取并解包) */
+typedef struct {
+  float H0_rH, H1_rH;           // 湿度标定点 (%)
+  int16_t H0_T0_OUT, H1_T0_OUT; // 湿度标定点对应的原始输出
+  float T0_degC, T1_degC;       // 温度标定点 (°C)
+  int16_t T0_OUT, T1_OUT;       // 温度标定点对应的原始输出
+} HTS221_Calib_t;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static HTS221_Calib_t calib;
+
+/* 批量事务的原始数据落点 (HUMIDITY_OUT_L..TEMP_OUT_H), DMA落点钉在SRAM2 */
+SRAM2_BSS static uint8_t raw_data[HTS221_DATA_LENGTH];
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef HTS221_ReadReg(uint8_t reg_addr, uint8_t *data, uint16_t length);
+static HAL_StatusTypeDef HTS221_WriteReg(uint8_t reg_addr, uint8_t *data, uint16_t length);
+static HAL_StatusTypeDef HTS221_ReadCalibration(void);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  初始化HTS221传感器 (读取出厂标定块)
+ * @param  config: 传感器配置参数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_Init(HTS221_Config_t *config)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t who_am_i = 0;
+  uint8_t reg_value = 0;
+
+  /* 检查设备ID */
+  status = HTS221_ReadWhoAmI(&who_am_i);
+  if (status != HAL_OK || who_am_i != HTS221_WHO_AM_I_VALUE) {
+    return HAL_ERROR;
+  }
+
+  /* 读取出厂标定参数 (转换依赖线性插值) */
+  status = HTS221_ReadCalibration();
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  /* 上电 + BDU + 输出速率 */
+  reg_value = HTS221_CTRL_REG1_PD | HTS221_CTRL_REG1_BDU | config->odr;
+  status = HTS221_WriteReg(HTS221_CTRL_REG1, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  读取HTS221 WHO_AM_I寄存器
+ * @param  who_am_i: 返回的设备ID
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_ReadWhoAmI(uint8_t *who_am_i)
+{
+  return HTS221_ReadReg(HTS221_WHO_AM_I, who_am_i, 1);
+}
+
+/**
+ * @brief  填充湿度+温度突发读取的总线操作描述符
+ * @param  op: I2CBus_Submit事务中的操作描述符
+ * @retval None
+ */
+void HTS221_PrepareReadOp(I2CBusOp_t *op)
+{
+  op->dev_addr = HTS221_I2C_ADDRESS;
+  op->reg_addr = HTS221_HUMIDITY_OUT_L | HTS221_AUTO_INCREMENT;
+  op->is_write = 0;
+  op->data = raw_data;
+  op->length = HTS221_DATA_LENGTH;
+  op->result = HAL_OK;
+}
+
+/**
+ * @brief  转换已读取的原始数据 (标定点间线性插值)
+ * @param  data: 返回的传感器数据
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_ParseData(HTS221_Data_t *data)
+{
+  int16_t raw_hum, raw_temp;
+
+  raw_hum = (int16_t)((uint16_t)raw_data[1] << 8 | raw_data[0]);
+  raw_temp = (int16_t)((uint16_t)raw_data[3] << 8 | raw_data[2]);
+
+  if (calib.H1_T0_OUT == calib.H0_T0_OUT || calib.T1_OUT == calib.T0_OUT) {
+    return HAL_ERROR;  // 标定块无效
+  }
+
+  data->humidity = calib.H0_rH +
+                   (calib.H1_rH - calib.H0_rH) *
+                   (float)(raw_hum - calib.H0_T0_OUT) /
+                   (float)(calib.H1_T0_OUT - calib.H0_T0_OUT);
+  data->temperature = calib.T0_degC +
+                      (calib.T1_degC - calib.T0_degC) *
+                      (float)(raw_temp - calib.T0_OUT) /
+                      (float)(calib.T1_OUT - calib.T0_OUT);
+
+  /* 湿度限幅到物理范围 */
+  if (data->humidity > 100.0f) {
+    data->humidity = 100.0f;
+  } else if (data->humidity < 0.0f) {
+    data->humidity = 0.0f;
+  }
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  读取HTS221传感器数据 (独立单操作事务)
+ * @param  data: 返回的传感器数据
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_ReadData(HTS221_Data_t *data)
+{
+  HAL_StatusTypeDef status;
+
+  status = HTS221_ReadReg(HTS221_HUMIDITY_OUT_L | HTS221_AUTO_INCREMENT,
+                          raw_data, HTS221_DATA_LENGTH);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  return HTS221_ParseData(data);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  读取并解包出厂标定块 (0x30..0x3F)
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef HTS221_ReadCalibration(void)
+{
+  HAL_StatusTypeDef status;
+  uint8_t buf[HTS221_CALIB_LENGTH];
+  uint16_t t0_raw, t1_raw;
+
+  status = HTS221_ReadReg(HTS221_CALIB_START | HTS221_AUTO_INCREMENT,
+                          buf, HTS221_CALIB_LENGTH);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  calib.H0_rH = (float)buf[0] / 2.0f;           // H0_rH_x2
+  calib.H1_rH = (float)buf[1] / 2.0f;           // H1_rH_x2
+
+  /* 温度标定点为10位值, 高2位在0x35 */
+  t0_raw = (uint16_t)buf[2] | (((uint16_t)buf[5] & 0x03) << 8);
+  t1_raw = (uint16_t)buf[3] | (((uint16_t)buf[5] & 0x0C) << 6);
+  calib.T0_degC = (float)t0_raw / 8.0f;
+  calib.T1_degC = (float)t1_raw / 8.0f;
+
+  calib.H0_T0_OUT = (int16_t)((uint16_t)buf[7] << 8 | buf[6]);
+  calib.H1_T0_OUT = (int16_t)((uint16_t)buf[11] << 8 | buf[10]);
+  calib.T0_OUT = (int16_t)((uint16_t)buf[13] << 8 | buf[12]);
+  calib.T1_OUT = (int16_t)((uint16_t)buf[15] << 8 | buf[14]);
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  HTS221寄存器读取
+ * @param  reg_addr: 寄存器地址
+ * @param  data: 读取的数据缓冲区
+ * @param  length: 数据长度
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef HTS221_ReadReg(uint8_t reg_addr, uint8_t *data, uint16_t length)
+{
+  return I2CBus_MemRead(HTS221_I2C_ADDRESS, reg_addr, data, length);
+}
+
+/**
+ * @brief  HTS221寄存器写入
+ * @param  reg_addr: 寄存器地址
+ * @param  data: 写入的数据缓冲区
+ * @param  length: 数据长度
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef HTS221_WriteReg(uint8_t reg_addr, uint8_t *data, uint16_t length)
+{
+  return I2CBus_MemWrite(HTS221_I2C_ADDRESS, reg_addr, data, length);
+}
@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file           : hts221.h
+ * @brief          : HTS221 humidity sensor driver header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : HTS221 relative humidity and temperature sensor driver
+ *                  - 0-100% rH, 16-bit output
+ *                  - Embedded temperature sensor, 16-bit output
+ *                  - Factory calibration read once at init, conversion by
+ *                    linear interpolation on the host side of the bus
+ *                  - I2C interface on the shared non-blocking bus engine
+ *                  - Prepare/Parse split so the acquisition task can batch
+ *                    the read with other sensors in one bus transaction
+ ******************************************************************************
+ */
+
+#ifndef __HTS221_H
+#define __HTS221_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "i2c_bus.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* HTS221 configuration structure */
+typedef struct {
+  uint8_t odr;              // Output data rate (HTS221_ODR_xxx)
+} HTS221_Config_t;
+
+/* HTS221 data structure */
+typedef struct {
+  float humidity;           // Relative humidity (%)
+  float temperature;        // Temperature (°C)
+} HTS221_Data_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* HTS221 device address */
+#define HTS221_I2C_ADDRESS          0x5F
+
+/* HTS221 register addresses */
+#define HTS221_WHO_AM_I             0x0F
+#define HTS221_AV_CONF              0x10
+#define HTS221_CTRL_REG1            0x20
+#define HTS221_STATUS_REG           0x27
+#define HTS221_HUMIDITY_OUT_L       0x28
+#define HTS221_HUMIDITY_OUT_H       0x29
+#define HTS221_TEMP_OUT_L           0x2A
+#define HTS221_TEMP_OUT_H           0x2B
+#define HTS221_CALIB_START          0x30
+
+/* Multi-byte access requires the address auto-increment bit */
+#define HTS221_AUTO_INCREMENT       0x80
+
+/* WHO_AM_I value */
+#define HTS221_WHO_AM_I_VALUE       0xBC
+
+/* CTRL_REG1 bit definitions */
+#define HTS221_CTRL_REG1_PD         0x80  // Power-up
+#define HTS221_CTRL_REG1_BDU        0x04  // Block data update
+
+/* Output data rate configuration (CTRL_REG1 bits 1:0) */
+#define HTS221_ODR_ONE_SHOT         0x00
+#define HTS221_ODR_1_HZ             0x01
+#define HTS221_ODR_7_HZ             0x02
+#define HTS221_ODR_12_5_HZ          0x03
+
+/* Calibration block length (0x30..0x3F) */
+#define HTS221_CALIB_LENGTH         16
+
+/* Humidity + temperature burst read length (0x28..0x2B) */
+#define HTS221_DATA_LENGTH          4
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize HTS221 sensor (reads the factory calibration block)
+ * @param  config: sensor configuration parameters
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_Init(HTS221_Config_t *config);
+
+/**
+ * @brief  Read HTS221 WHO_AM_I register
+ * @param  who_am_i: returned device ID
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_ReadWhoAmI(uint8_t *who_am_i);
+
+/**
+ * @brief  Fill a bus operation that burst-reads humidity + temperature
+ * @param  op: operation descriptor for an I2CBus_Submit transaction
+ * @retval None
+ */
+void HTS221_PrepareReadOp(I2CBusOp_t *op);
+
+/**
+ * @brief  Convert the raw bytes fetched by the prepared operation
+ * @param  data: returned sensor data
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_ParseData(HTS221_Data_t *data);
+
+/**
+ * @brief  Read HTS221 sensor data (standalone single-op transaction)
+ * @param  data: returned sensor data
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef HTS221_ReadData(HTS221_Data_t *data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HTS221_H */
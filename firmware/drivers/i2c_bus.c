@@ -0,0 +1,372 @@
+/**
+ ******************************************************************************
+ * @file           : i2c_bus.c
+ * @brief          : Non-blocking I2C transfer engine implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Replaces the blocking HAL_I2C_Mem_Read/Write calls in the
+ *                   sensor drivers. Transfers run on DMA, and all bus access
+ *                   goes through a single bus-owner task fed by a request
+ *                   queue: a submitter enqueues a transaction of one or more
+ *                   operations, the bus task runs them back-to-back and wakes
+ *                   the submitter once. Serialization comes from the queue,
+ *                   so there is no per-register mutex traffic and no priority
+ *                   inversion window on the bus.
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "i2c_bus.h"
+#include "itm_trace.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define I2C_BUS_SUBMIT_TIMEOUT_MS   100
+#define I2C_BUS_TRANSFER_TIMEOUT_MS 100
+
+#define I2C_BUS_TASK_STACK_SIZE     256
+/* Above every submitter so a queued transaction starts immediately */
+#define I2C_BUS_TASK_PRIORITY       (tskIDLE_PRIORITY + 5)
+#define I2C_BUS_QUEUE_LENGTH        8
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static DMA_HandleTypeDef hdma_i2c2_rx;
+static DMA_HandleTypeDef hdma_i2c2_tx;
+
+static TaskHandle_t xI2CBusTaskHandle = NULL;
+static StaticTask_t xI2CBusTaskTCB;
+static StackType_t xI2CBusTaskStack[I2C_BUS_TASK_STACK_SIZE];
+
+/* Pending transaction pointers, consumed by the bus-owner task */
+static QueueHandle_t xI2CBusQueue = NULL;
+static StaticQueue_t xI2CBusQueueBuffer;
+static uint8_t ucI2CBusQueueStorage[I2C_BUS_QUEUE_LENGTH * sizeof(I2CBusTransaction_t *)];
+
+/* Task currently waiting for a DMA transfer to complete (bus task itself) */
+static volatile TaskHandle_t xWaitingTask = NULL;
+
+/* Private function prototypes -----------------------------------------------*/
+static void I2CBusTask(void *pvParameters);
+static HAL_StatusTypeDef I2CBus_WaitForTransfer(void);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Initialize the I2C bus engine (DMA channels and interrupts)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_Init(void)
+{
+  /* Enable DMA controller clock */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* I2C2_RX on DMA1 channel 5 */
+  hdma_i2c2_rx.Instance = DMA1_Channel5;
+  hdma_i2c2_rx.Init.Request = DMA_REQUEST_3;
+  hdma_i2c2_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_i2c2_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_i2c2_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_i2c2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_i2c2_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_i2c2_rx.Init.Mode = DMA_NORMAL;
+  hdma_i2c2_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  if (HAL_DMA_Init(&hdma_i2c2_rx) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  __HAL_LINKDMA(&hi2c2, hdmarx, hdma_i2c2_rx);
+
+  /* I2C2_TX on DMA1 channel 4 */
+  hdma_i2c2_tx.Instance = DMA1_Channel4;
+  hdma_i2c2_tx.Init.Request = DMA_REQUEST_3;
+  hdma_i2c2_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_i2c2_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_i2c2_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_i2c2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_i2c2_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_i2c2_tx.Init.Mode = DMA_NORMAL;
+  hdma_i2c2_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  if (HAL_DMA_Init(&hdma_i2c2_tx) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  __HAL_LINKDMA(&hi2c2, hdmatx, hdma_i2c2_tx);
+
+  /* DMA and I2C event/error interrupts - must be callable from FreeRTOS */
+  HAL_NVIC_SetPriority(DMA1_Channel4_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+  HAL_NVIC_SetPriority(DMA1_Channel5_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel5_IRQn);
+  HAL_NVIC_SetPriority(I2C2_EV_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(I2C2_EV_IRQn);
+  HAL_NVIC_SetPriority(I2C2_ER_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(I2C2_ER_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Create the bus-owner task that executes queued transactions
+ * @retval BaseType_t
+ */
+BaseType_t I2CBus_CreateTask(void)
+{
+  xI2CBusQueue = xQueueCreateStatic(I2C_BUS_QUEUE_LENGTH,
+                                    sizeof(I2CBusTransaction_t *),
+                                    ucI2CBusQueueStorage, &xI2CBusQueueBuffer);
+  if (xI2CBusQueue == NULL) {
+    return pdFAIL;
+  }
+
+  xI2CBusTaskHandle = xTaskCreateStatic(I2CBusTask, "I2CBus",
+                                        I2C_BUS_TASK_STACK_SIZE, NULL,
+                                        I2C_BUS_TASK_PRIORITY,
+                                        xI2CBusTaskStack, &xI2CBusTaskTCB);
+  return (xI2CBusTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  Submit a transaction and sleep until the whole batch completes
+ * @param  txn: transaction descriptor (ops filled in by the caller)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_Submit(I2CBusTransaction_t *txn)
+{
+  uint32_t event = 0;
+
+  if (txn == NULL || txn->ops == NULL || txn->op_count == 0) {
+    return HAL_ERROR;
+  }
+
+  txn->submitter = xTaskGetCurrentTaskHandle();
+  if (xQueueSend(xI2CBusQueue, &txn,
+                 pdMS_TO_TICKS(I2C_BUS_SUBMIT_TIMEOUT_MS)) != pdPASS) {
+    return HAL_TIMEOUT;
+  }
+
+  /* One wakeup for the whole batch; budget scales with its size. The
+   * budget covers only this transaction's own ops - transactions queued
+   * ahead of it can legitimately push completion past it, so a timeout
+   * here means "over budget", not "abandoned". */
+  if (xTaskNotifyWaitIndexed(I2C_BUS_NOTIFY_INDEX, 0, UINT32_MAX, &event,
+                             pdMS_TO_TICKS(I2C_BUS_TRANSFER_TIMEOUT_MS *
+                                           (uint32_t)txn->op_count)) != pdTRUE) {
+    /* The transaction and its ops (typically on this stack frame) stay
+     * owned by the bus task until it notifies. Returning now would let
+     * the frame be reclaimed while a pending DMA still writes into it,
+     * and the late notification would be mistaken for the completion of
+     * this task's next submit. Block until the bus task hands the
+     * transaction back - its per-op waits are bounded and the queue is
+     * finite, so this wait terminates - then report the overrun. */
+    xTaskNotifyWaitIndexed(I2C_BUS_NOTIFY_INDEX, 0, UINT32_MAX, &event,
+                           portMAX_DELAY);
+    return HAL_TIMEOUT;
+  }
+
+  return (event & I2C_BUS_EVENT_ERROR) ? HAL_ERROR : HAL_OK;
+}
+
+/**
+ * @brief  Read sensor registers over I2C (non-blocking, DMA + notification)
+ * @param  dev_addr: 7-bit device address
+ * @param  reg_addr: register address
+ * @param  data: read data buffer
+ * @param  length: data length
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_MemRead(uint8_t dev_addr, uint8_t reg_addr,
+                                 uint8_t *data, uint16_t length)
+{
+  I2CBusOp_t op = {dev_addr, reg_addr, 0, data, length, HAL_OK};
+  I2CBusTransaction_t txn = {&op, 1, NULL, HAL_OK};
+
+  /* Blocking fallback while the scheduler (or bus task) is not running */
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED ||
+      xI2CBusTaskHandle == NULL) {
+    return HAL_I2C_Mem_Read(&hi2c2, dev_addr << 1, reg_addr,
+                            I2C_MEMADD_SIZE_8BIT, data, length,
+                            I2C_BUS_TRANSFER_TIMEOUT_MS);
+  }
+
+  return I2CBus_Submit(&txn);
+}
+
+/**
+ * @brief  Write sensor registers over I2C (non-blocking, DMA + notification)
+ * @param  dev_addr: 7-bit device address
+ * @param  reg_addr: register address
+ * @param  data: write data buffer
+ * @param  length: data length
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_MemWrite(uint8_t dev_addr, uint8_t reg_addr,
+                                  uint8_t *data, uint16_t length)
+{
+  I2CBusOp_t op = {dev_addr, reg_addr, 1, data, length, HAL_OK};
+  I2CBusTransaction_t txn = {&op, 1, NULL, HAL_OK};
+
+  /* Blocking fallback while the scheduler (or bus task) is not running */
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED ||
+      xI2CBusTaskHandle == NULL) {
+    return HAL_I2C_Mem_Write(&hi2c2, dev_addr << 1, reg_addr,
+                             I2C_MEMADD_SIZE_8BIT, data, length,
+                             I2C_BUS_TRANSFER_TIMEOUT_MS);
+  }
+
+  return I2CBus_Submit(&txn);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Bus-owner task - runs queued transactions back-to-back
+ * @param  pvParameters: task parameters
+ * @retval None
+ */
+static void I2CBusTask(void *pvParameters)
+{
+  I2CBusTransaction_t *txn;
+  HAL_StatusTypeDef status;
+
+  for (;;) {
+    if (xQueueReceive(xI2CBusQueue, &txn, portMAX_DELAY) != pdPASS) {
+      continue;
+    }
+
+    /* Operations within one transaction run back-to-back; the bus is
+     * never handed to another submitter mid-batch */
+    txn->status = HAL_OK;
+    TRACE_I2C_START(txn->ops[0].dev_addr);
+    for (uint8_t i = 0; i < txn->op_count; i++) {
+      I2CBusOp_t *op = &txn->ops[i];
+
+      xWaitingTask = xI2CBusTaskHandle;
+      if (op->is_write) {
+        status = HAL_I2C_Mem_Write_DMA(&hi2c2, op->dev_addr << 1, op->reg_addr,
+                                       I2C_MEMADD_SIZE_8BIT, op->data, op->length);
+      } else {
+        status = HAL_I2C_Mem_Read_DMA(&hi2c2, op->dev_addr << 1, op->reg_addr,
+                                      I2C_MEMADD_SIZE_8BIT, op->data, op->length);
+      }
+      if (status == HAL_OK) {
+        /* Sleep until the transfer-complete (or error) interrupt */
+        status = I2CBus_WaitForTransfer();
+      }
+      xWaitingTask = NULL;
+
+      op->result = status;
+      if (status != HAL_OK && txn->status == HAL_OK) {
+        txn->status = status;  // Record first error, remaining ops still run
+      }
+    }
+
+    TRACE_I2C_DONE((uint32_t)txn->status);
+
+    /* Single wakeup of the submitter once the whole batch is done */
+    xTaskNotifyIndexed(txn->submitter, I2C_BUS_NOTIFY_INDEX,
+                       (txn->status == HAL_OK) ? I2C_BUS_EVENT_COMPLETE
+                                               : I2C_BUS_EVENT_ERROR,
+                       eSetBits);
+  }
+}
+
+/**
+ * @brief  Block the calling task until the current transfer completes
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef I2CBus_WaitForTransfer(void)
+{
+  uint32_t event = 0;
+
+  if (xTaskNotifyWaitIndexed(I2C_BUS_NOTIFY_INDEX, 0, UINT32_MAX, &event,
+                             pdMS_TO_TICKS(I2C_BUS_TRANSFER_TIMEOUT_MS)) != pdTRUE) {
+    return HAL_TIMEOUT;
+  }
+
+  return (event & I2C_BUS_EVENT_ERROR) ? HAL_ERROR : HAL_OK;
+}
+
+/**
+ * @brief  Wake the waiting task from an ISR callback
+ * @param  event: I2C_BUS_EVENT_COMPLETE or I2C_BUS_EVENT_ERROR
+ * @retval None
+ */
+static void I2CBus_NotifyFromISR(uint32_t event)
+{
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+  if (xWaitingTask != NULL) {
+    xTaskNotifyIndexedFromISR(xWaitingTask, I2C_BUS_NOTIFY_INDEX, event,
+                              eSetBits, &xHigherPriorityTaskWoken);
+  }
+
+  portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/* HAL callbacks and interrupt handlers --------------------------------------*/
+
+/**
+ * @brief  I2C memory read transfer complete callback
+ */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c2) {
+    I2CBus_NotifyFromISR(I2C_BUS_EVENT_COMPLETE);
+  }
+}
+
+/**
+ * @brief  I2C memory write transfer complete callback
+ */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c2) {
+    I2CBus_NotifyFromISR(I2C_BUS_EVENT_COMPLETE);
+  }
+}
+
+/**
+ * @brief  I2C transfer error callback
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c2) {
+    I2CBus_NotifyFromISR(I2C_BUS_EVENT_ERROR);
+  }
+}
+
+/**
+ * @brief  DMA1 channel 4 interrupt handler (I2C2_TX)
+ */
+void DMA1_Channel4_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_i2c2_tx);
+}
+
+/**
+ * @brief  DMA1 channel 5 interrupt handler (I2C2_RX)
+ */
+void DMA1_Channel5_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_i2c2_rx);
+}
+
+/**
+ * @brief  I2C2 event interrupt handler
+ */
+void I2C2_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hi2c2);
+}
+
+/**
+ * @brief  I2C2 error interrupt handler
+ */
+void I2C2_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hi2c2);
+}
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file           : i2c_bus.h
+ * @brief          : Non-blocking I2C transfer engine header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Shared DMA-based I2C transfer engine for the sensor bus
+ *                  - DMA register read/write with task-notification completion
+ *                  - Calling task sleeps during the transfer (no busy-wait)
+ *                  - A dedicated bus-owner task serializes all transfers;
+ *                    submitters queue a transaction (one or more back-to-back
+ *                    operations) and receive a single wakeup when the whole
+ *                    batch is done, instead of one lock round-trip per register
+ ******************************************************************************
+ */
+
+#ifndef __I2C_BUS_H
+#define __I2C_BUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* One bus operation inside a transaction */
+typedef struct {
+  uint8_t dev_addr;             // 7-bit device address
+  uint8_t reg_addr;             // Register address
+  uint8_t is_write;             // 0 = read, 1 = write
+  uint8_t *data;                // Caller-owned data buffer
+  uint16_t length;              // Transfer length in bytes
+  HAL_StatusTypeDef result;     // Per-operation result (filled by bus task)
+} I2CBusOp_t;
+
+/* A batch of operations executed back-to-back in one bus session.
+ * The ops array stays owned by the submitter and must remain valid
+ * until I2CBus_Submit returns. */
+typedef struct {
+  I2CBusOp_t *ops;              // Operation array
+  uint8_t op_count;             // Number of operations
+  TaskHandle_t submitter;       // Filled by I2CBus_Submit
+  HAL_StatusTypeDef status;     // First failing status, HAL_OK if all passed
+} I2CBusTransaction_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Task notification index reserved for I2C transfer completion */
+#define I2C_BUS_NOTIFY_INDEX        1
+
+/* Notification values posted from the I2C ISR callbacks */
+#define I2C_BUS_EVENT_COMPLETE      0x01
+#define I2C_BUS_EVENT_ERROR         0x02
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize the I2C bus engine (DMA channels and interrupts)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_Init(void);
+
+/**
+ * @brief  Create the bus-owner task that executes queued transactions
+ * @retval BaseType_t
+ */
+BaseType_t I2CBus_CreateTask(void);
+
+/**
+ * @brief  Submit a transaction and sleep until the whole batch completes.
+ *         Never returns while the bus task still owns the transaction:
+ *         HAL_TIMEOUT reports a blown time budget, but only after the
+ *         batch has been executed and handed back, so txn and its ops
+ *         may live on the caller's stack.
+ * @param  txn: transaction descriptor (ops filled in by the caller)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_Submit(I2CBusTransaction_t *txn);
+
+/**
+ * @brief  Read sensor registers over I2C (non-blocking, DMA + notification)
+ * @param  dev_addr: 7-bit device address
+ * @param  reg_addr: register address
+ * @param  data: read data buffer
+ * @param  length: data length
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_MemRead(uint8_t dev_addr, uint8_t reg_addr,
+                                 uint8_t *data, uint16_t length);
+
+/**
+ * @brief  Write sensor registers over I2C (non-blocking, DMA + notification)
+ * @param  dev_addr: 7-bit device address
+ * @param  reg_addr: register address
+ * @param  data: write data buffer
+ * @param  length: data length
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef I2CBus_MemWrite(uint8_t dev_addr, uint8_t reg_addr,
+                                  uint8_t *data, uint16_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __I2C_BUS_H */
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file           : lps22hb.c
+ * @brief          : LPS22HB气压传感器驱动程序实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lps22hb.h"
+#include "sram2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* 批量事务的原始数据落点 (PRESS_OUT_XL..TEMP_OUT_H), DMA落点钉在SRAM2 */
+SRAM2_BSS static uint8_t raw_data[LPS22HB_DATA_LENGTH];
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef LPS22HB_ReadReg(uint8_t reg_addr, uint8_t *data, uint16_t length);
+static HAL_StatusTypeDef LPS22HB_WriteReg(uint8_t reg_addr, uint8_t *data, uint16_t length);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  初始化LPS22HB传感器
+ * @param  config: 传感器配置参数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_Init(LPS22HB_Config_t *config)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t who_am_i = 0;
+  uint8_t reg_value = 0;
+
+  /* 检查设备ID */
+  status = LPS22HB_ReadWhoAmI(&who_am_i);
+  if (status != HAL_OK || who_am_i != LPS22HB_WHO_AM_I_VALUE) {
+    return HAL_ERROR;
+  }
+
+  /* 配置输出速率 + BDU, 低速连续模式由传感器自主采样 */
+  reg_value = config->odr | LPS22HB_CTRL_REG1_BDU;
+  status = LPS22HB_WriteReg(LPS22HB_CTRL_REG1, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  读取LPS22HB WHO_AM_I寄存器
+ * @param  who_am_i: 返回的设备ID
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_ReadWhoAmI(uint8_t *who_am_i)
+{
+  return LPS22HB_ReadReg(LPS22HB_WHO_AM_I, who_am_i, 1);
+}
+
+/**
+ * @brief  填充气压+温度突发读取的总线操作描述符
+ * @param  op: I2CBus_Submit事务中的操作描述符
+ * @retval None
+ */
+void LPS22HB_PrepareReadOp(I2CBusOp_t *op)
+{
+  op->dev_addr = LPS22HB_I2C_ADDRESS;
+  op->reg_addr = LPS22HB_PRESS_OUT_XL;  // IF_ADD_INC默认开启, 地址自增
+  op->is_write = 0;
+  op->data = raw_data;
+  op->length = LPS22HB_DATA_LENGTH;
+  op->result = HAL_OK;
+}
+
+/**
+ * @brief  转换已读取的原始数据
+ * @param  data: 返回的传感器数据
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_ParseData(LPS22HB_Data_t *data)
+{
+  int32_t raw_press;
+  int16_t raw_temp;
+
+  /* 24位压力值, 符号扩展 */
+  raw_press = (int32_t)((uint32_t)raw_data[2] << 16 |
+                        (uint32_t)raw_data[1] << 8 | raw_data[0]);
+  if (raw_press & 0x00800000) {
+    raw_press |= 0xFF000000;
+  }
+  raw_temp = (int16_t)((uint16_t)raw_data[4] << 8 | raw_data[3]);
+
+  data->pressure = (float)raw_press / LPS22HB_PRESS_SENSITIVITY;
+  data->temperature = (float)raw_temp / LPS22HB_TEMP_SENSITIVITY;
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  读取LPS22HB传感器数据 (独立单操作事务)
+ * @param  data: 返回的传感器数据
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_ReadData(LPS22HB_Data_t *data)
+{
+  HAL_StatusTypeDef status;
+
+  status = LPS22HB_ReadReg(LPS22HB_PRESS_OUT_XL, raw_data, LPS22HB_DATA_LENGTH);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  return LPS22HB_ParseData(data);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  LPS22HB寄存器读取
+ * @param  reg_addr: 寄存器地址
+ * @param  data: 读取的数据缓冲区
+ * @param  length: 数据长度
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef LPS22HB_ReadReg(uint8_t reg_addr, uint8_t *data, uint16_t length)
+{
+  return I2CBus_MemRead(LPS22HB_I2C_ADDRESS, reg_addr, data, length);
+}
+
+/**
+ * @brief  LPS22HB寄存器写入
+ * @param  reg_addr: 寄存器地址
+ * @param  data: 写入的数据缓冲区
+ * @param  length: 数据长度
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef LPS22HB_WriteReg(uint8_t reg_addr, uint8_t *data, uint16_t length)
+{
+  return I2CBus_MemWrite(LPS22HB_I2C_ADDRESS, reg_addr, data, length);
+}
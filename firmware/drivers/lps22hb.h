@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ * @file           : lps22hb.h
+ * @brief          : LPS22HB pressure sensor driver header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : LPS22HB barometric pressure sensor driver
+ *                  - 260-1260 hPa absolute pressure, 24-bit output
+ *                  - Embedded temperature sensor, 16-bit output
+ *                  - I2C interface on the shared non-blocking bus engine
+ *                  - Prepare/Parse split so the acquisition task can batch
+ *                    the read with other sensors in one bus transaction
+ ******************************************************************************
+ */
+
+#ifndef __LPS22HB_H
+#define __LPS22HB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "i2c_bus.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* LPS22HB configuration structure */
+typedef struct {
+  uint8_t odr;              // Output data rate (LPS22HB_ODR_xxx)
+} LPS22HB_Config_t;
+
+/* LPS22HB data structure */
+typedef struct {
+  float pressure;           // Pressure (hPa)
+  float temperature;        // Temperature (°C)
+} LPS22HB_Data_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* LPS22HB device address (SA0 high on B-L475E-IOT01A) */
+#define LPS22HB_I2C_ADDRESS         0x5D
+
+/* LPS22HB register addresses */
+#define LPS22HB_WHO_AM_I            0x0F
+#define LPS22HB_CTRL_REG1           0x10
+#define LPS22HB_CTRL_REG2           0x11
+#define LPS22HB_STATUS              0x27
+#define LPS22HB_PRESS_OUT_XL        0x28
+#define LPS22HB_PRESS_OUT_L         0x29
+#define LPS22HB_PRESS_OUT_H         0x2A
+#define LPS22HB_TEMP_OUT_L          0x2B
+#define LPS22HB_TEMP_OUT_H          0x2C
+
+/* WHO_AM_I value */
+#define LPS22HB_WHO_AM_I_VALUE      0xB1
+
+/* Output data rate configuration (CTRL_REG1 bits 6:4) */
+#define LPS22HB_ODR_POWER_DOWN      0x00  // One-shot mode
+#define LPS22HB_ODR_1_HZ            0x10
+#define LPS22HB_ODR_10_HZ           0x20
+#define LPS22HB_ODR_25_HZ           0x30
+#define LPS22HB_ODR_50_HZ           0x40
+#define LPS22HB_ODR_75_HZ           0x50
+
+/* CTRL_REG1 bit definitions */
+#define LPS22HB_CTRL_REG1_BDU       0x02  // Block data update
+
+/* Sensitivities */
+#define LPS22HB_PRESS_SENSITIVITY   4096.0f  // LSB/hPa
+#define LPS22HB_TEMP_SENSITIVITY    100.0f   // LSB/°C
+
+/* Pressure + temperature burst read length (0x28..0x2C) */
+#define LPS22HB_DATA_LENGTH         5
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize LPS22HB sensor
+ * @param  config: sensor configuration parameters
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_Init(LPS22HB_Config_t *config);
+
+/**
+ * @brief  Read LPS22HB WHO_AM_I register
+ * @param  who_am_i: returned device ID
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_ReadWhoAmI(uint8_t *who_am_i);
+
+/**
+ * @brief  Fill a bus operation that burst-reads pressure + temperature
+ * @param  op: operation descriptor for an I2CBus_Submit transaction
+ * @retval None
+ */
+void LPS22HB_PrepareReadOp(I2CBusOp_t *op);
+
+/**
+ * @brief  Convert the raw bytes fetched by the prepared operation
+ * @param  data: returned sensor data
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_ParseData(LPS22HB_Data_t *data);
+
+/**
+ * @brief  Read LPS22HB sensor data (standalone single-op transaction)
+ * @param  data: returned sensor data
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LPS22HB_ReadData(LPS22HB_Data_t *data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LPS22HB_H */
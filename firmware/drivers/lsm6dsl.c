@@ -10,6 +10,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dsl.h"
+#include "i2c_bus.h"
+#include "sram2.h"
 #include "FreeRTOS.h"
 #include "semphr.h"
 
@@ -20,13 +22,21 @@
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#ifdef LSM6DSL_FIXED_CONFIG
+/* 固定配置: 灵敏度为编译期常量, 换算乘法被常量折叠 */
+static const float accel_sensitivity = LSM6DSL_ACCEL_SENSITIVITY;
+static const float gyro_sensitivity = LSM6DSL_GYRO_SENSITIVITY;
+#else
 static float accel_sensitivity = 0.061f;   // mg/LSB for ±2g
 static float gyro_sensitivity = 8.75f;     // mdps/LSB for ±250dps
+#endif
 
 /* Private function prototypes -----------------------------------------------*/
 static HAL_StatusTypeDef LSM6DSL_ReadReg(uint8_t reg_addr, uint8_t *data, uint16_t length);
 static HAL_StatusTypeDef LSM6DSL_WriteReg(uint8_t reg_addr, uint8_t *data, uint16_t length);
+#ifndef LSM6DSL_FIXED_CONFIG
 static void LSM6DSL_UpdateSensitivity(uint8_t accel_fs, uint8_t gyro_fs);
+#endif
 
 /* Private user code ---------------------------------------------------------*/
 
@@ -57,14 +67,23 @@ HAL_StatusTypeDef LSM6DSL_Init(LSM6DSL_Config_t *config)
   vTaskDelay(pdMS_TO_TICKS(10));
 
   /* 配置加速度计 */
+#ifdef LSM6DSL_FIXED_CONFIG
+  /* 固定配置: 寄存器值在编译期定死, 忽略结构体里的速率/量程字段 */
+  reg_value = LSM6DSL_FIXED_ACCEL_ODR | LSM6DSL_FIXED_ACCEL_FS;
+#else
   reg_value = config->accel_odr | config->accel_fs;
+#endif
   status = LSM6DSL_WriteReg(LSM6DSL_CTRL1_XL, &reg_value, 1);
   if (status != HAL_OK) {
     return status;
   }
 
   /* 配置陀螺仪 */
+#ifdef LSM6DSL_FIXED_CONFIG
+  reg_value = LSM6DSL_FIXED_GYRO_ODR | LSM6DSL_FIXED_GYRO_FS;
+#else
   reg_value = config->gyro_odr | config->gyro_fs;
+#endif
   status = LSM6DSL_WriteReg(LSM6DSL_CTRL2_G, &reg_value, 1);
   if (status != HAL_OK) {
     return status;
@@ -77,12 +96,232 @@ HAL_StatusTypeDef LSM6DSL_Init(LSM6DSL_Config_t *config)
     return status;
   }
 
+  /* 配置硬件FIFO (批量读取模式) */
+  if (config->fifo_enable) {
+    status = LSM6DSL_ConfigFIFO(config);
+    if (status != HAL_OK) {
+      return status;
+    }
+  }
+
+#ifndef LSM6DSL_FIXED_CONFIG
   /* 更新灵敏度系数 */
   LSM6DSL_UpdateSensitivity(config->accel_fs, config->gyro_fs);
+#endif
 
   return HAL_OK;
 }
 
+/**
+ * @brief  配置LSM6DSL硬件FIFO (连续模式 + 水位线)
+ * @param  config: 传感器配置参数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ConfigFIFO(LSM6DSL_Config_t *config)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t reg_value = 0;
+  uint16_t watermark_words;
+
+  /* 水位线以16位字为单位, 每个样本6个字 (陀螺仪+加速度计) */
+  if (config->fifo_watermark == 0 ||
+      config->fifo_watermark > LSM6DSL_FIFO_MAX_BATCH) {
+    return HAL_ERROR;
+  }
+  watermark_words = config->fifo_watermark * LSM6DSL_FIFO_WORDS_PER_SAMPLE;
+
+  /* 先进入Bypass模式清空FIFO */
+  reg_value = LSM6DSL_FIFO_MODE_BYPASS;
+  status = LSM6DSL_WriteReg(LSM6DSL_FIFO_CTRL5, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  /* FIFO水位线 (FTH[10:0]) */
+  reg_value = (uint8_t)(watermark_words & 0xFF);
+  status = LSM6DSL_WriteReg(LSM6DSL_FIFO_CTRL1, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+  reg_value = (uint8_t)((watermark_words >> 8) & 0x07);
+  status = LSM6DSL_WriteReg(LSM6DSL_FIFO_CTRL2, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  /* 陀螺仪和加速度计均无抽取 (DEC_FIFO_GYRO = DEC_FIFO_XL = 1) */
+  reg_value = 0x09;
+  status = LSM6DSL_WriteReg(LSM6DSL_FIFO_CTRL3, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  /* FIFO ODR与加速度计ODR一致, 连续模式 (满时覆盖最旧样本) */
+  reg_value = (uint8_t)((config->accel_odr >> 1) | LSM6DSL_FIFO_MODE_CONTINUOUS);
+  return LSM6DSL_WriteReg(LSM6DSL_FIFO_CTRL5, &reg_value, 1);
+}
+
+/**
+ * @brief  读取FIFO水位/状态
+ * @param  level: 返回FIFO中未读16位字数
+ * @param  flags: 返回FIFO_STATUS2标志位 (可为NULL)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_GetFIFOLevel(uint16_t *level, uint8_t *flags)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t fifo_status[2] = {0};
+
+  /* FIFO_STATUS1/2连续读取: DIFF_FIFO[10:0] + 状态标志 */
+  status = LSM6DSL_ReadReg(LSM6DSL_FIFO_STATUS1, fifo_status, 2);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  *level = (uint16_t)(((fifo_status[1] & 0x07) << 8) | fifo_status[0]);
+  if (flags != NULL) {
+    *flags = fifo_status[1] & (LSM6DSL_FIFO_STATUS2_WATERM |
+                               LSM6DSL_FIFO_STATUS2_OVR |
+                               LSM6DSL_FIFO_STATUS2_EMPTY);
+  }
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  批量读取FIFO数据 (单次连续读取排空水位线以下样本)
+ * @param  data: 样本输出数组
+ * @param  max_samples: 数组容量
+ * @param  read_samples: 实际读取的样本数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ReadFIFO(LSM6DSL_Data_t *data, uint16_t max_samples,
+                                   uint16_t *read_samples)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  SRAM2_BSS static uint8_t raw_fifo[LSM6DSL_FIFO_MAX_BATCH * LSM6DSL_FIFO_BYTES_PER_SAMPLE];
+  uint16_t fifo_level = 0;
+  uint16_t sample_count;
+  uint32_t timestamp;
+  int16_t raw_word;
+
+  *read_samples = 0;
+
+  /* 查询FIFO当前水位 */
+  status = LSM6DSL_GetFIFOLevel(&fifo_level, NULL);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  sample_count = fifo_level / LSM6DSL_FIFO_WORDS_PER_SAMPLE;
+  if (sample_count == 0) {
+    return HAL_OK;  // FIFO样本不足, 不是错误
+  }
+  if (sample_count > max_samples) {
+    sample_count = max_samples;
+  }
+  if (sample_count > LSM6DSL_FIFO_MAX_BATCH) {
+    sample_count = LSM6DSL_FIFO_MAX_BATCH;
+  }
+
+  /* 一次连续读取排空全部样本 (FIFO数据寄存器自动回卷) */
+  status = LSM6DSL_ReadReg(LSM6DSL_FIFO_DATA_OUT_L, raw_fifo,
+                           sample_count * LSM6DSL_FIFO_BYTES_PER_SAMPLE);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  /* 解析样本: FIFO模式为 Gx Gy Gz Ax Ay Az, FIFO无温度通道 */
+  timestamp = xTaskGetTickCount();
+  for (uint16_t i = 0; i < sample_count; i++) {
+    const uint8_t *raw = &raw_fifo[i * LSM6DSL_FIFO_BYTES_PER_SAMPLE];
+
+    raw_word = (int16_t)((raw[1] << 8) | raw[0]);
+    data[i].gyro_x = (float)raw_word * gyro_sensitivity * 3.14159f / (180.0f * 1000.0f);
+    raw_word = (int16_t)((raw[3] << 8) | raw[2]);
+    data[i].gyro_y = (float)raw_word * gyro_sensitivity * 3.14159f / (180.0f * 1000.0f);
+    raw_word = (int16_t)((raw[5] << 8) | raw[4]);
+    data[i].gyro_z = (float)raw_word * gyro_sensitivity * 3.14159f / (180.0f * 1000.0f);
+
+    raw_word = (int16_t)((raw[7] << 8) | raw[6]);
+    data[i].accel_x = (float)raw_word * accel_sensitivity * 9.80665f / 1000.0f;
+    raw_word = (int16_t)((raw[9] << 8) | raw[8]);
+    data[i].accel_y = (float)raw_word * accel_sensitivity * 9.80665f / 1000.0f;
+    raw_word = (int16_t)((raw[11] << 8) | raw[10]);
+    data[i].accel_z = (float)raw_word * accel_sensitivity * 9.80665f / 1000.0f;
+
+    data[i].temperature = 0.0f;
+    data[i].timestamp = timestamp;
+    data[i].data_ready = 1;
+  }
+
+  *read_samples = sample_count;
+  return HAL_OK;
+}
+
+/**
+ * @brief  批量读取FIFO原始数据 (不做单位转换, 配合LSM6DSL_GetScale使用)
+ * @param  data: 原始样本输出数组
+ * @param  max_samples: 数组容量
+ * @param  read_samples: 实际读取的样本数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ReadFIFORaw(LSM6DSL_RawSample_t *data,
+                                      uint16_t max_samples,
+                                      uint16_t *read_samples)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  SRAM2_BSS static uint8_t raw_fifo[LSM6DSL_FIFO_MAX_BATCH * LSM6DSL_FIFO_BYTES_PER_SAMPLE];
+  uint16_t fifo_level = 0;
+  uint16_t sample_count;
+  uint32_t timestamp;
+
+  *read_samples = 0;
+
+  /* 查询FIFO当前水位 */
+  status = LSM6DSL_GetFIFOLevel(&fifo_level, NULL);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  sample_count = fifo_level / LSM6DSL_FIFO_WORDS_PER_SAMPLE;
+  if (sample_count == 0) {
+    return HAL_OK;  // FIFO样本不足, 不是错误
+  }
+  if (sample_count > max_samples) {
+    sample_count = max_samples;
+  }
+  if (sample_count > LSM6DSL_FIFO_MAX_BATCH) {
+    sample_count = LSM6DSL_FIFO_MAX_BATCH;
+  }
+
+  /* 一次连续读取排空全部样本 (FIFO数据寄存器自动回卷) */
+  status = LSM6DSL_ReadReg(LSM6DSL_FIFO_DATA_OUT_L, raw_fifo,
+                           sample_count * LSM6DSL_FIFO_BYTES_PER_SAMPLE);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  /* 解析样本: FIFO模式为 Gx Gy Gz Ax Ay Az, 原始计数直接拼接 */
+  timestamp = xTaskGetTickCount();
+  for (uint16_t i = 0; i < sample_count; i++) {
+    const uint8_t *raw = &raw_fifo[i * LSM6DSL_FIFO_BYTES_PER_SAMPLE];
+
+    data[i].gyro[0] = (int16_t)((raw[1] << 8) | raw[0]);
+    data[i].gyro[1] = (int16_t)((raw[3] << 8) | raw[2]);
+    data[i].gyro[2] = (int16_t)((raw[5] << 8) | raw[4]);
+    data[i].accel[0] = (int16_t)((raw[7] << 8) | raw[6]);
+    data[i].accel[1] = (int16_t)((raw[9] << 8) | raw[8]);
+    data[i].accel[2] = (int16_t)((raw[11] << 8) | raw[10]);
+    data[i].temperature = 0;
+    data[i].timestamp = timestamp;
+    data[i].data_ready = 1;
+  }
+
+  *read_samples = sample_count;
+  return HAL_OK;
+}
+
 /**
  * @brief  读取LSM6DSL WHO_AM_I寄存器
  * @param  who_am_i: 返回的设备ID
@@ -101,36 +340,33 @@ HAL_StatusTypeDef LSM6DSL_ReadWhoAmI(uint8_t *who_am_i)
 HAL_StatusTypeDef LSM6DSL_ReadData(LSM6DSL_Data_t *data)
 {
   HAL_StatusTypeDef status = HAL_OK;
-  uint8_t raw_data[14] = {0};
+  uint8_t raw_data[16] = {0};
   int16_t raw_temp, raw_gyro[3], raw_accel[3];
   uint8_t status_reg = 0;
 
-  /* 检查数据是否准备就绪 */
-  status = LSM6DSL_GetStatus(&status_reg);
+  /* STATUS_REG(0x1E)紧邻输出寄存器(0x20起), 一次突发读取同时取回
+   * 状态和数据, 省掉每个样本一次独立的状态查询事务:
+   *   [0] = STATUS_REG, [1] = 保留(0x1F), [2..15] = 温度+陀螺仪+加速度计 */
+  status = LSM6DSL_ReadReg(LSM6DSL_STATUS_REG, raw_data, 16);
   if (status != HAL_OK) {
     return status;
   }
 
+  status_reg = raw_data[0];
   data->data_ready = (status_reg & (LSM6DSL_STATUS_XLDA | LSM6DSL_STATUS_GDA)) ? 1 : 0;
-  
+
   if (!data->data_ready) {
     return HAL_OK;  // 数据未准备就绪，但不是错误
   }
 
-  /* 读取温度和6轴数据 (连续读取) */
-  status = LSM6DSL_ReadReg(LSM6DSL_OUT_TEMP_L, raw_data, 14);
-  if (status != HAL_OK) {
-    return status;
-  }
-
-  /* 解析原始数据 */
-  raw_temp = (int16_t)((raw_data[1] << 8) | raw_data[0]);
-  raw_gyro[0] = (int16_t)((raw_data[3] << 8) | raw_data[2]);   // X轴陀螺仪
-  raw_gyro[1] = (int16_t)((raw_data[5] << 8) | raw_data[4]);   // Y轴陀螺仪
-  raw_gyro[2] = (int16_t)((raw_data[7] << 8) | raw_data[6]);   // Z轴陀螺仪
-  raw_accel[0] = (int16_t)((raw_data[9] << 8) | raw_data[8]);  // X轴加速度计
-  raw_accel[1] = (int16_t)((raw_data[11] << 8) | raw_data[10]); // Y轴加速度计
-  raw_accel[2] = (int16_t)((raw_data[13] << 8) | raw_data[12]); // Z轴加速度计
+  /* 解析原始数据 (偏移+2跳过状态和保留字节) */
+  raw_temp = (int16_t)((raw_data[3] << 8) | raw_data[2]);
+  raw_gyro[0] = (int16_t)((raw_data[5] << 8) | raw_data[4]);   // X轴陀螺仪
+  raw_gyro[1] = (int16_t)((raw_data[7] << 8) | raw_data[6]);   // Y轴陀螺仪
+  raw_gyro[2] = (int16_t)((raw_data[9] << 8) | raw_data[8]);   // Z轴陀螺仪
+  raw_accel[0] = (int16_t)((raw_data[11] << 8) | raw_data[10]);  // X轴加速度计
+  raw_accel[1] = (int16_t)((raw_data[13] << 8) | raw_data[12]); // Y轴加速度计
+  raw_accel[2] = (int16_t)((raw_data[15] << 8) | raw_data[14]); // Z轴加速度计
 
   /* 转换为实际物理量 */
   data->temperature = 25.0f + (float)raw_temp / 256.0f;  // °C
@@ -151,6 +387,60 @@ HAL_StatusTypeDef LSM6DSL_ReadData(LSM6DSL_Data_t *data)
   return HAL_OK;
 }
 
+/**
+ * @brief  读取LSM6DSL原始传感器数据 (不做单位转换)
+ * @param  data: 返回的原始样本
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ReadDataRaw(LSM6DSL_RawSample_t *data)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t raw_data[16] = {0};
+  uint8_t status_reg = 0;
+
+  /* 与LSM6DSL_ReadData相同的突发读取, 但保留原始计数:
+   *   [0] = STATUS_REG, [1] = 保留(0x1F), [2..15] = 温度+陀螺仪+加速度计 */
+  status = LSM6DSL_ReadReg(LSM6DSL_STATUS_REG, raw_data, 16);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  status_reg = raw_data[0];
+  data->data_ready = (status_reg & (LSM6DSL_STATUS_XLDA | LSM6DSL_STATUS_GDA)) ? 1 : 0;
+
+  if (!data->data_ready) {
+    return HAL_OK;  // 数据未准备就绪，但不是错误
+  }
+
+  data->temperature = (int16_t)((raw_data[3] << 8) | raw_data[2]);
+  data->gyro[0] = (int16_t)((raw_data[5] << 8) | raw_data[4]);
+  data->gyro[1] = (int16_t)((raw_data[7] << 8) | raw_data[6]);
+  data->gyro[2] = (int16_t)((raw_data[9] << 8) | raw_data[8]);
+  data->accel[0] = (int16_t)((raw_data[11] << 8) | raw_data[10]);
+  data->accel[1] = (int16_t)((raw_data[13] << 8) | raw_data[12]);
+  data->accel[2] = (int16_t)((raw_data[15] << 8) | raw_data[14]);
+
+  data->timestamp = xTaskGetTickCount();
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  获取当前满量程配置对应的物理单位换算系数
+ * @param  accel_lsb: 返回每计数对应的m/s² (可为NULL)
+ * @param  gyro_lsb: 返回每计数对应的rad/s (可为NULL)
+ * @retval None
+ */
+void LSM6DSL_GetScale(float *accel_lsb, float *gyro_lsb)
+{
+  if (accel_lsb != NULL) {
+    *accel_lsb = accel_sensitivity * 9.80665f / 1000.0f;
+  }
+  if (gyro_lsb != NULL) {
+    *gyro_lsb = gyro_sensitivity * 3.14159f / (180.0f * 1000.0f);
+  }
+}
+
 /**
  * @brief  检查数据是否准备就绪
  * @param  status: 返回的状态寄存器值
@@ -205,14 +495,98 @@ HAL_StatusTypeDef LSM6DSL_Enable(uint8_t enable)
 }
 
 /**
- * @brief  配置LSM6DSL中断
- * @param  int_config: 中断配置
+ * @brief  配置LSM6DSL INT1中断路由 (数据就绪/FIFO水位线)
+ * @param  int_config: INT1_CTRL位组合 (LSM6DSL_INT1_xxx)
  * @retval HAL_StatusTypeDef
  */
 HAL_StatusTypeDef LSM6DSL_ConfigInterrupt(uint8_t int_config)
 {
   uint8_t reg_value = int_config;
-  return LSM6DSL_WriteReg(LSM6DSL_CTRL4_C, &reg_value, 1);
+  return LSM6DSL_WriteReg(LSM6DSL_INT1_CTRL, &reg_value, 1);
+}
+
+/**
+ * @brief  运行时切换加速度计/陀螺仪输出速率 (保留量程配置)
+ * @param  config: 传感器配置参数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_SetDataRate(LSM6DSL_Config_t *config)
+{
+  HAL_StatusTypeDef status;
+  uint8_t reg_value;
+
+  if (config == NULL) {
+    return HAL_ERROR;
+  }
+
+  reg_value = config->accel_odr | config->accel_fs;
+  status = LSM6DSL_WriteReg(LSM6DSL_CTRL1_XL, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  reg_value = config->gyro_odr | config->gyro_fs;
+  status = LSM6DSL_WriteReg(LSM6DSL_CTRL2_G, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+#ifndef LSM6DSL_FIXED_CONFIG
+  LSM6DSL_UpdateSensitivity(config->accel_fs, config->gyro_fs);
+#endif
+  return HAL_OK;
+}
+
+/**
+ * @brief  配置硬件唤醒引擎 (加速度斜率检测)
+ * @param  threshold: 唤醒阈值, 1 LSB = FS_XL/64 (±2g时为31.25mg)
+ * @param  duration: 超阈值持续时间, 1 LSB = 1个ODR周期
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ConfigWakeUp(uint8_t threshold, uint8_t duration)
+{
+  HAL_StatusTypeDef status;
+  uint8_t reg_value;
+
+  /* 使能基础中断功能, 锁存模式: 事件保持到WAKE_UP_SRC被读取 */
+  reg_value = LSM6DSL_TAP_CFG_INT_ENABLE | LSM6DSL_TAP_CFG_LIR;
+  status = LSM6DSL_WriteReg(LSM6DSL_TAP_CFG, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  reg_value = threshold & LSM6DSL_WAKE_UP_THS_MASK;
+  status = LSM6DSL_WriteReg(LSM6DSL_WAKE_UP_THS, &reg_value, 1);
+  if (status != HAL_OK) {
+    return status;
+  }
+
+  reg_value = (uint8_t)((duration & 0x03) << LSM6DSL_WAKE_UP_DUR_SHIFT);
+  return LSM6DSL_WriteReg(LSM6DSL_WAKE_UP_DUR, &reg_value, 1);
+}
+
+/**
+ * @brief  使能/禁用唤醒事件到INT1的路由 (MD1_CFG)
+ * @param  enable: 1-路由, 0-断开
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_RouteWakeUp(uint8_t enable)
+{
+  uint8_t reg_value = enable ? LSM6DSL_MD1_CFG_INT1_WU : 0x00;
+  return LSM6DSL_WriteReg(LSM6DSL_MD1_CFG, &reg_value, 1);
+}
+
+/**
+ * @brief  读取唤醒事件源寄存器 (同时清除锁存的中断)
+ * @param  src: 返回WAKE_UP_SRC寄存器值
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_GetWakeUpSource(uint8_t *src)
+{
+  if (src == NULL) {
+    return HAL_ERROR;
+  }
+  return LSM6DSL_ReadReg(LSM6DSL_WAKE_UP_SRC, src, 1);
 }
 
 /* Private functions ---------------------------------------------------------*/
@@ -226,21 +600,8 @@ HAL_StatusTypeDef LSM6DSL_ConfigInterrupt(uint8_t int_config)
  */
 static HAL_StatusTypeDef LSM6DSL_ReadReg(uint8_t reg_addr, uint8_t *data, uint16_t length)
 {
-  HAL_StatusTypeDef status = HAL_OK;
-  
-  /* 获取I2C互斥锁 */
-  if (xSemaphoreTake(xI2CMutex, pdMS_TO_TICKS(LSM6DSL_TIMEOUT_MS)) == pdTRUE) {
-    /* I2C读取 */
-    status = HAL_I2C_Mem_Read(&hi2c2, LSM6DSL_I2C_ADDRESS << 1, reg_addr, 
-                              I2C_MEMADD_SIZE_8BIT, data, length, LSM6DSL_TIMEOUT_MS);
-    
-    /* 释放I2C互斥锁 */
-    xSemaphoreGive(xI2CMutex);
-  } else {
-    status = HAL_TIMEOUT;
-  }
-
-  return status;
+  /* DMA传输期间任务休眠, 互斥锁由总线引擎管理 */
+  return I2CBus_MemRead(LSM6DSL_I2C_ADDRESS, reg_addr, data, length);
 }
 
 /**
@@ -252,23 +613,11 @@ static HAL_StatusTypeDef LSM6DSL_ReadReg(uint8_t reg_addr, uint8_t *data, uint16
  */
 static HAL_StatusTypeDef LSM6DSL_WriteReg(uint8_t reg_addr, uint8_t *data, uint16_t length)
 {
-  HAL_StatusTypeDef status = HAL_OK;
-  
-  /* 获取I2C互斥锁 */
-  if (xSemaphoreTake(xI2CMutex, pdMS_TO_TICKS(LSM6DSL_TIMEOUT_MS)) == pdTRUE) {
-    /* I2C写入 */
-    status = HAL_I2C_Mem_Write(&hi2c2, LSM6DSL_I2C_ADDRESS << 1, reg_addr, 
-                               I2C_MEMADD_SIZE_8BIT, data, length, LSM6DSL_TIMEOUT_MS);
-    
-    /* 释放I2C互斥锁 */
-    xSemaphoreGive(xI2CMutex);
-  } else {
-    status = HAL_TIMEOUT;
-  }
-
-  return status;
+  /* DMA传输期间任务休眠, 互斥锁由总线引擎管理 */
+  return I2CBus_MemWrite(LSM6DSL_I2C_ADDRESS, reg_addr, data, length);
 }
 
+#ifndef LSM6DSL_FIXED_CONFIG
 /**
  * @brief  根据满量程配置更新灵敏度系数
  * @param  accel_fs: 加速度计满量程配置
@@ -317,4 +666,5 @@ static void LSM6DSL_UpdateSensitivity(uint8_t accel_fs, uint8_t gyro_fs)
       gyro_sensitivity = 8.75f;
       break;
   }
-}
\ No newline at end of file
+}
+#endif /* LSM6DSL_FIXED_CONFIG */
\ No newline at end of file
@@ -32,6 +32,7 @@ typedef struct {
   uint8_t gyro_odr;         // Gyroscope output data rate
   uint8_t gyro_fs;          // Gyroscope full scale
   uint8_t fifo_enable;      // FIFO enable
+  uint16_t fifo_watermark;  // FIFO watermark (samples, gyro+accel sets)
 } LSM6DSL_Config_t;
 
 /* LSM6DSL data structure */
@@ -43,6 +44,16 @@ typedef struct {
   uint8_t data_ready;                 // Data ready flag
 } LSM6DSL_Data_t;
 
+/* LSM6DSL raw data structure - sensor counts without unit conversion; the
+ * scale factors to physical units come from LSM6DSL_GetScale */
+typedef struct {
+  int16_t accel[3];                   // Raw accelerometer counts
+  int16_t gyro[3];                    // Raw gyroscope counts
+  int16_t temperature;                // Raw temperature (25°C + raw/256)
+  uint32_t timestamp;                 // Timestamp
+  uint8_t data_ready;                 // Data ready flag
+} LSM6DSL_RawSample_t;
+
 /* Exported constants --------------------------------------------------------*/
 
 /* LSM6DSL device addresses */
@@ -50,6 +61,13 @@ typedef struct {
 #define LSM6DSL_I2C_ADDRESS_HIGH    0x6B
 
 /* LSM6DSL register addresses */
+#define LSM6DSL_FIFO_CTRL1          0x06
+#define LSM6DSL_FIFO_CTRL2          0x07
+#define LSM6DSL_FIFO_CTRL3          0x08
+#define LSM6DSL_FIFO_CTRL4          0x09
+#define LSM6DSL_FIFO_CTRL5          0x0A
+#define LSM6DSL_INT1_CTRL           0x0D
+#define LSM6DSL_INT2_CTRL           0x0E
 #define LSM6DSL_WHO_AM_I            0x0F
 #define LSM6DSL_CTRL1_XL            0x10
 #define LSM6DSL_CTRL2_G             0x11
@@ -62,6 +80,7 @@ typedef struct {
 #define LSM6DSL_CTRL9_XL            0x18
 #define LSM6DSL_CTRL10_C            0x19
 
+#define LSM6DSL_WAKE_UP_SRC         0x1B
 #define LSM6DSL_STATUS_REG          0x1E
 #define LSM6DSL_OUT_TEMP_L          0x20
 #define LSM6DSL_OUT_TEMP_H          0x21
@@ -78,6 +97,18 @@ typedef struct {
 #define LSM6DSL_OUTZ_L_XL           0x2C
 #define LSM6DSL_OUTZ_H_XL           0x2D
 
+#define LSM6DSL_TAP_CFG             0x58
+#define LSM6DSL_WAKE_UP_THS         0x5B
+#define LSM6DSL_WAKE_UP_DUR         0x5C
+#define LSM6DSL_MD1_CFG             0x5E
+
+#define LSM6DSL_FIFO_STATUS1        0x3A
+#define LSM6DSL_FIFO_STATUS2        0x3B
+#define LSM6DSL_FIFO_STATUS3        0x3C
+#define LSM6DSL_FIFO_STATUS4        0x3D
+#define LSM6DSL_FIFO_DATA_OUT_L     0x3E
+#define LSM6DSL_FIFO_DATA_OUT_H     0x3F
+
 /* WHO_AM_I value */
 #define LSM6DSL_WHO_AM_I_VALUE      0x6A
 
@@ -120,11 +151,84 @@ typedef struct {
 #define LSM6DSL_GY_FS_1000_DPS      0x08
 #define LSM6DSL_GY_FS_2000_DPS      0x0C
 
+/* Compile-time configuration specialization: deployments that fix ODR and
+ * full scale forever can build with LSM6DSL_FIXED_CONFIG (build.py
+ * --profile). The settings below are then baked in as constants, the
+ * sensitivity statics become const (constant-folded into the conversion
+ * math) and the runtime dispatch switches are compiled out. Individual
+ * LSM6DSL_FIXED_* macros can be overridden from the build to define other
+ * fixed profiles. Without LSM6DSL_FIXED_CONFIG the runtime-configurable
+ * path is unchanged. */
+#ifdef LSM6DSL_FIXED_CONFIG
+
+#ifndef LSM6DSL_FIXED_ACCEL_ODR
+#define LSM6DSL_FIXED_ACCEL_ODR     LSM6DSL_XL_ODR_104_HZ
+#endif
+#ifndef LSM6DSL_FIXED_ACCEL_FS
+#define LSM6DSL_FIXED_ACCEL_FS      LSM6DSL_XL_FS_2G
+#endif
+#ifndef LSM6DSL_FIXED_GYRO_ODR
+#define LSM6DSL_FIXED_GYRO_ODR      LSM6DSL_GY_ODR_104_HZ
+#endif
+#ifndef LSM6DSL_FIXED_GYRO_FS
+#define LSM6DSL_FIXED_GYRO_FS       LSM6DSL_GY_FS_250_DPS
+#endif
+
+/* Sensitivities derived from the fixed full scale at preprocessing time */
+#if LSM6DSL_FIXED_ACCEL_FS == LSM6DSL_XL_FS_2G
+#define LSM6DSL_ACCEL_SENSITIVITY   0.061f   // mg/LSB
+#elif LSM6DSL_FIXED_ACCEL_FS == LSM6DSL_XL_FS_4G
+#define LSM6DSL_ACCEL_SENSITIVITY   0.122f
+#elif LSM6DSL_FIXED_ACCEL_FS == LSM6DSL_XL_FS_8G
+#define LSM6DSL_ACCEL_SENSITIVITY   0.244f
+#else
+#define LSM6DSL_ACCEL_SENSITIVITY   0.488f
+#endif
+
+#if LSM6DSL_FIXED_GYRO_FS == LSM6DSL_GY_FS_125_DPS
+#define LSM6DSL_GYRO_SENSITIVITY    4.375f   // mdps/LSB
+#elif LSM6DSL_FIXED_GYRO_FS == LSM6DSL_GY_FS_250_DPS
+#define LSM6DSL_GYRO_SENSITIVITY    8.75f
+#elif LSM6DSL_FIXED_GYRO_FS == LSM6DSL_GY_FS_500_DPS
+#define LSM6DSL_GYRO_SENSITIVITY    17.50f
+#elif LSM6DSL_FIXED_GYRO_FS == LSM6DSL_GY_FS_1000_DPS
+#define LSM6DSL_GYRO_SENSITIVITY    35.0f
+#else
+#define LSM6DSL_GYRO_SENSITIVITY    70.0f
+#endif
+
+#endif /* LSM6DSL_FIXED_CONFIG */
+
 /* Status register bit definitions */
 #define LSM6DSL_STATUS_TDA          0x04  // Temperature data available
 #define LSM6DSL_STATUS_GDA          0x02  // Gyroscope data available
 #define LSM6DSL_STATUS_XLDA         0x01  // Accelerometer data available
 
+/* FIFO configuration */
+#define LSM6DSL_FIFO_MODE_BYPASS    0x00  // FIFO disabled
+#define LSM6DSL_FIFO_MODE_CONTINUOUS 0x06 // Continuous mode, overwrite on full
+#define LSM6DSL_FIFO_WORDS_PER_SAMPLE 6   // Gyro X/Y/Z + accel X/Y/Z (16-bit words)
+#define LSM6DSL_FIFO_BYTES_PER_SAMPLE (LSM6DSL_FIFO_WORDS_PER_SAMPLE * 2)
+#define LSM6DSL_FIFO_MAX_BATCH      30    // Max samples drained per burst read
+
+/* FIFO_STATUS2 bit definitions */
+#define LSM6DSL_FIFO_STATUS2_WATERM 0x80  // Watermark reached
+#define LSM6DSL_FIFO_STATUS2_OVR    0x40  // FIFO overrun
+#define LSM6DSL_FIFO_STATUS2_EMPTY  0x10  // FIFO empty
+
+/* INT1_CTRL bit definitions */
+#define LSM6DSL_INT1_DRDY_XL        0x01  // Accelerometer data-ready on INT1
+#define LSM6DSL_INT1_DRDY_G         0x02  // Gyroscope data-ready on INT1
+#define LSM6DSL_INT1_FTH            0x08  // FIFO watermark on INT1
+
+/* Wake-up engine bit definitions */
+#define LSM6DSL_TAP_CFG_INT_ENABLE  0x80  // Enable basic interrupt functions
+#define LSM6DSL_TAP_CFG_LIR         0x01  // Latch interrupt until source read
+#define LSM6DSL_MD1_CFG_INT1_WU     0x20  // Route wake-up event to INT1
+#define LSM6DSL_WAKE_UP_SRC_WU_IA   0x08  // Wake-up event detected
+#define LSM6DSL_WAKE_UP_THS_MASK    0x3F  // Threshold, 1 LSB = FS_XL/64
+#define LSM6DSL_WAKE_UP_DUR_SHIFT   5     // Duration bits [6:5], 1 LSB = 1 ODR
+
 /* Exported macro ------------------------------------------------------------*/
 
 /* Exported functions prototypes ---------------------------------------------*/
@@ -150,6 +254,21 @@ HAL_StatusTypeDef LSM6DSL_ReadWhoAmI(uint8_t *who_am_i);
  */
 HAL_StatusTypeDef LSM6DSL_ReadData(LSM6DSL_Data_t *data);
 
+/**
+ * @brief  读取LSM6DSL原始传感器数据 (不做单位转换)
+ * @param  data: 返回的原始样本
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ReadDataRaw(LSM6DSL_RawSample_t *data);
+
+/**
+ * @brief  获取当前满量程配置对应的物理单位换算系数
+ * @param  accel_lsb: 返回每计数对应的m/s² (可为NULL)
+ * @param  gyro_lsb: 返回每计数对应的rad/s (可为NULL)
+ * @retval None
+ */
+void LSM6DSL_GetScale(float *accel_lsb, float *gyro_lsb);
+
 /**
  * @brief  检查数据是否准备就绪
  * @param  status: 返回的状态寄存器值
@@ -171,12 +290,77 @@ HAL_StatusTypeDef LSM6DSL_SoftReset(void);
 HAL_StatusTypeDef LSM6DSL_Enable(uint8_t enable);
 
 /**
- * @brief  配置LSM6DSL中断
- * @param  int_config: 中断配置
+ * @brief  配置LSM6DSL INT1中断路由 (数据就绪/FIFO水位线)
+ * @param  int_config: INT1_CTRL位组合 (LSM6DSL_INT1_xxx)
  * @retval HAL_StatusTypeDef
  */
 HAL_StatusTypeDef LSM6DSL_ConfigInterrupt(uint8_t int_config);
 
+/**
+ * @brief  配置LSM6DSL硬件FIFO (连续模式 + 水位线)
+ * @param  config: 传感器配置参数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ConfigFIFO(LSM6DSL_Config_t *config);
+
+/**
+ * @brief  读取FIFO水位/状态
+ * @param  level: 返回FIFO中未读16位字数
+ * @param  flags: 返回FIFO_STATUS2标志位 (可为NULL)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_GetFIFOLevel(uint16_t *level, uint8_t *flags);
+
+/**
+ * @brief  批量读取FIFO数据 (单次连续读取排空水位线以下样本)
+ * @param  data: 样本输出数组
+ * @param  max_samples: 数组容量
+ * @param  read_samples: 实际读取的样本数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ReadFIFO(LSM6DSL_Data_t *data, uint16_t max_samples,
+                                   uint16_t *read_samples);
+
+/**
+ * @brief  批量读取FIFO原始数据 (不做单位转换, 配合LSM6DSL_GetScale使用)
+ * @param  data: 原始样本输出数组
+ * @param  max_samples: 数组容量
+ * @param  read_samples: 实际读取的样本数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ReadFIFORaw(LSM6DSL_RawSample_t *data,
+                                      uint16_t max_samples,
+                                      uint16_t *read_samples);
+
+/**
+ * @brief  运行时切换加速度计/陀螺仪输出速率 (保留量程配置)
+ * @param  config: 传感器配置参数
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_SetDataRate(LSM6DSL_Config_t *config);
+
+/**
+ * @brief  配置硬件唤醒引擎 (加速度斜率检测)
+ * @param  threshold: 唤醒阈值, 1 LSB = FS_XL/64 (±2g时为31.25mg)
+ * @param  duration: 超阈值持续时间, 1 LSB = 1个ODR周期
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_ConfigWakeUp(uint8_t threshold, uint8_t duration);
+
+/**
+ * @brief  使能/禁用唤醒事件到INT1的路由 (MD1_CFG)
+ * @param  enable: 1-路由, 0-断开
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_RouteWakeUp(uint8_t enable);
+
+/**
+ * @brief  读取唤醒事件源寄存器 (同时清除锁存的中断)
+ * @param  src: 返回WAKE_UP_SRC寄存器值
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LSM6DSL_GetWakeUpSource(uint8_t *src);
+
 /* Private functions ---------------------------------------------------------*/
 
 /**
@@ -28,7 +28,10 @@
 
 /* Core Configuration */
 #define configUSE_PREEMPTION              1
-#define configSUPPORT_STATIC_ALLOCATION   0
+/* All kernel objects (tasks, queues, mutexes) are created from compile-time
+ * buffers for deterministic startup and zero heap fragmentation; the heap is
+ * kept only as a small fallback and can be audited via free_heap telemetry. */
+#define configSUPPORT_STATIC_ALLOCATION   1
 #define configSUPPORT_DYNAMIC_ALLOCATION  1
 #define configUSE_IDLE_HOOK               1
 #define configUSE_TICK_HOOK               0
@@ -36,7 +39,7 @@
 #define configTICK_RATE_HZ                ((TickType_t)1000)
 #define configMAX_PRIORITIES              ( 7 )
 #define configMINIMAL_STACK_SIZE          ((uint16_t)128)
-#define configTOTAL_HEAP_SIZE             ((size_t)15360)
+#define configTOTAL_HEAP_SIZE             ((size_t)4096)
 #define configMAX_TASK_NAME_LEN           ( 16 )
 #define configUSE_16_BIT_TICKS            0
 #define configUSE_MUTEXES                 1
@@ -109,13 +112,35 @@ standard names. */
 /* IMPORTANT: This define is commented when used with STM32Cube firmware, to prevent overwriting SysTick_Handler defined within STM32Cube HAL */
 /* #define xPortSysTickHandler SysTick_Handler */
 
-/* USER CODE BEGIN 2 */    
-/* Runtime Statistics Clock Configuration */
+/* USER CODE BEGIN 2 */
+/* Runtime Statistics Clock Configuration (DWT cycle counter, profiling.c) */
 extern void configureTimerForRunTimeStats(void);
 extern unsigned long getRunTimeCounterValue(void);
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() configureTimerForRunTimeStats()
 #define portGET_RUN_TIME_COUNTER_VALUE() getRunTimeCounterValue()
 
+/* Context Switch Counting (profiling.c) + SWO task-switch trace (itm_trace.c).
+ * pxCurrentTCB is in scope at the expansion site inside tasks.c; uxTCBNumber
+ * is available because configUSE_TRACE_FACILITY is enabled */
+extern void vProfilingTaskSwitchedIn(void);
+extern void vTraceTaskSwitchedIn(uint32_t task_number);
+#define traceTASK_SWITCHED_IN() { vProfilingTaskSwitchedIn(); \
+                                  vTraceTaskSwitchedIn((uint32_t)pxCurrentTCB->uxTCBNumber); }
+
+/* SWO queue operation trace (itm_trace.c) */
+extern void vTraceQueueSend(uint32_t queue_number);
+extern void vTraceQueueReceive(uint32_t queue_number);
+extern void vTraceQueueSendFailed(uint32_t queue_number);
+#define traceQUEUE_SEND(pxQueue) vTraceQueueSend((uint32_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) vTraceQueueSend((uint32_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_RECEIVE(pxQueue) vTraceQueueReceive((uint32_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND_FAILED(pxQueue) vTraceQueueSendFailed((uint32_t)(pxQueue)->uxQueueNumber)
+
+/* Tickless Idle via STOP2 + LPTIM1 wakeup (lowpower.c) replaces the port's
+ * default SysTick-based sleep */
+extern void vLowPowerSuppressTicksAndSleep(uint32_t xExpectedIdleTime);
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) vLowPowerSuppressTicksAndSleep(xExpectedIdleTime)
+
 /* Memory Management Debug */
 #define configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES 1
 
@@ -0,0 +1,45 @@
+/**
+ ******************************************************************************
+ * @file           : bench.h
+ * @brief          : On-target microbenchmark suite header file
+ ******************************************************************************
+ * @description    : Benchmark firmware build (python build.py bench)
+ *                  - Measures the primitives the acquisition path depends
+ *                    on: I2C single vs burst reads, queue send/receive,
+ *                    notify-driven task wakeup (context switch), and the
+ *                    full LSM6DSL_ReadData driver call
+ *                  - Results go out over UART as machine-readable CSV lines
+ *                    (BENCH,<name>,<iters>,<min>,<avg>,<max> in DWT cycles)
+ *                    for regression tracking by build.py
+ *                  - Compiled only when BENCH_BUILD is defined; the normal
+ *                    pipeline tasks are not created in that build
+ ******************************************************************************
+ */
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the benchmark task (BENCH_BUILD only)
+ * @retval BaseType_t
+ */
+BaseType_t Bench_CreateTask(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BENCH_H */
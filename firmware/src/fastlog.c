@@ -0,0 +1,214 @@
+/**
+ ******************************************************************************
+ * @file           : fastlog.c
+ * @brief          : Deferred-format binary logging implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Replaces the blocking snprintf + HAL_UART_Transmit logger
+ *                   in the real-time tasks. Producers push fixed-size binary
+ *                   records into a static ring; a low-priority task drains
+ *                   contiguous spans over UART DMA and sleeps on the transfer
+ *                   complete notification. One enqueue costs microseconds,
+ *                   formatting is done on the host (tools/log_decoder.py).
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fastlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define LOG_TASK_STACK_SIZE         256
+#define LOG_TASK_PRIORITY           (tskIDLE_PRIORITY + 1)
+#define LOG_RING_MASK               (LOG_RING_RECORDS - 1)
+#define LOG_DRAIN_PERIOD_MS         50
+#define LOG_DMA_TIMEOUT_MS          100
+
+/* Task notification index for UART DMA completion (index 0 is the generic
+ * wakeup channel, index 1 belongs to the I2C engine) */
+#define LOG_UART_NOTIFY_INDEX       2
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static LogRecord_t xLogRing[LOG_RING_RECORDS];
+static volatile uint16_t usLogHead = 0;   // Next record to write (producers)
+static volatile uint16_t usLogTail = 0;   // Next record to drain (drain task)
+static volatile uint32_t ulDroppedRecords = 0;
+
+static TaskHandle_t xLogTaskHandle = NULL;
+static StaticTask_t xLogTaskTCB;
+static StackType_t xLogTaskStack[LOG_TASK_STACK_SIZE];
+static DMA_HandleTypeDef hdma_usart1_tx;
+
+/* Private function prototypes -----------------------------------------------*/
+static void LogTask(void *pvParameters);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Initialize the logging subsystem (UART TX DMA channel)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Log_Init(void)
+{
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  /* USART1_TX on DMA2 channel 6 (DMA1 channel 4 belongs to I2C2_TX) */
+  hdma_usart1_tx.Instance = DMA2_Channel6;
+  hdma_usart1_tx.Init.Request = DMA_REQUEST_2;
+  hdma_usart1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_usart1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart1_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart1_tx.Init.Mode = DMA_NORMAL;
+  hdma_usart1_tx.Init.Priority = DMA_PRIORITY_LOW;
+  if (HAL_DMA_Init(&hdma_usart1_tx) != HAL_OK) {
+    return HAL_ERROR;
+  }
+  __HAL_LINKDMA(&huart1, hdmatx, hdma_usart1_tx);
+
+  HAL_NVIC_SetPriority(DMA2_Channel6_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Channel6_IRQn);
+  HAL_NVIC_SetPriority(USART1_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(USART1_IRQn);
+
+  usLogHead = 0;
+  usLogTail = 0;
+  ulDroppedRecords = 0;
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Create the background log drain task
+ * @retval BaseType_t
+ */
+BaseType_t Log_CreateTask(void)
+{
+  xLogTaskHandle = xTaskCreateStatic(LogTask, "Log", LOG_TASK_STACK_SIZE, NULL,
+                                     LOG_TASK_PRIORITY, xLogTaskStack,
+                                     &xLogTaskTCB);
+  return (xLogTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  Enqueue a log record (hot-path safe, no formatting or UART access)
+ * @param  id: log event ID
+ * @param  arg0: raw argument 0 (meaning defined per ID in the decoder)
+ * @param  arg1: raw argument 1
+ * @retval None
+ */
+void Log_Write(LogId_t id, uint32_t arg0, uint32_t arg1)
+{
+  uint16_t head;
+  LogRecord_t *record;
+
+  taskENTER_CRITICAL();
+  head = usLogHead;
+  if ((uint16_t)(head - usLogTail) >= LOG_RING_RECORDS) {
+    /* Ring full - drop the record, never block the caller */
+    ulDroppedRecords++;
+    taskEXIT_CRITICAL();
+    return;
+  }
+  /* Fill before publishing: the drain task snapshots usLogHead and may
+   * run between a head advance and the stores (it shares a priority with
+   * some callers), so an early publish would put a half-written record
+   * on the wire. 16 bytes of stores is cheap enough to keep inside the
+   * critical section. */
+  record = &xLogRing[head & LOG_RING_MASK];
+  record->magic = LOG_RECORD_MAGIC;
+  record->id = (uint16_t)id;
+  record->timestamp = xTaskGetTickCount();
+  record->arg0 = arg0;
+  record->arg1 = arg1;
+  usLogHead = head + 1;
+  taskEXIT_CRITICAL();
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Background drain task - streams pending records over UART DMA
+ * @param  pvParameters: task parameters
+ * @retval None
+ */
+static void LogTask(void *pvParameters)
+{
+  uint16_t tail, head, first, count;
+
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_PERIOD_MS));
+
+    /* Report producer-side drops once the ring has room again */
+    if (ulDroppedRecords > 0) {
+      uint32_t dropped = ulDroppedRecords;
+      ulDroppedRecords = 0;
+      Log_Write(LOG_ID_LOG_OVERFLOW, dropped, 0);
+    }
+
+    head = usLogHead;
+    tail = usLogTail;
+    while (tail != head) {
+      /* Largest contiguous span up to the ring wrap point */
+      first = tail & LOG_RING_MASK;
+      count = (uint16_t)(head - tail);
+      if (first + count > LOG_RING_RECORDS) {
+        count = LOG_RING_RECORDS - first;
+      }
+
+      if (HAL_UART_Transmit_DMA(&huart1, (uint8_t *)&xLogRing[first],
+                                count * sizeof(LogRecord_t)) != HAL_OK) {
+        break;  // UART busy - retry next period
+      }
+
+      /* Sleep until the DMA transfer completes */
+      if (ulTaskNotifyTakeIndexed(LOG_UART_NOTIFY_INDEX, pdTRUE,
+                                  pdMS_TO_TICKS(LOG_DMA_TIMEOUT_MS)) == 0) {
+        break;  // Transfer stuck - retry next period
+      }
+
+      tail = (uint16_t)(tail + count);
+      usLogTail = tail;
+    }
+  }
+}
+
+/* HAL callbacks and interrupt handlers --------------------------------------*/
+
+/**
+ * @brief  UART transmit complete callback - wake the drain task
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+  if (huart == &huart1 && xLogTaskHandle != NULL) {
+    vTaskNotifyGiveIndexedFromISR(xLogTaskHandle, LOG_UART_NOTIFY_INDEX,
+                                  &xHigherPriorityTaskWoken);
+  }
+
+  portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/**
+ * @brief  DMA2 channel 6 interrupt handler (USART1_TX)
+ */
+void DMA2_Channel6_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_usart1_tx);
+}
+
+/**
+ * @brief  USART1 interrupt handler
+ */
+void USART1_IRQHandler(void)
+{
+  HAL_UART_IRQHandler(&huart1);
+}
@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file           : fastlog.h
+ * @brief          : Deferred-format binary logging header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Low-cost logging for the real-time tasks
+ *                  - Log_Write enqueues a log ID plus raw arguments into a
+ *                    static ring (a few microseconds, no formatting, no UART)
+ *                  - A low-priority drain task streams records over UART DMA
+ *                  - Formatting happens off-target (tools/log_decoder.py)
+ ******************************************************************************
+ */
+
+#ifndef __FASTLOG_H
+#define __FASTLOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Log event IDs - keep in sync with the table in tools/log_decoder.py */
+typedef enum {
+  LOG_ID_NONE = 0,
+  /* Sensor acquisition */
+  LOG_ID_SENSOR_INIT_FAILED,
+  LOG_ID_SENSOR_INT1_CONFIG_FAILED,
+  LOG_ID_SENSOR_TASK_CREATED,
+  LOG_ID_SENSOR_TASK_CREATE_FAILED,
+  LOG_ID_SENSOR_TASK_STARTED,
+  LOG_ID_SENSOR_QUEUE_SEND_FAILED,
+  LOG_ID_SENSOR_MAX_RETRIES,
+  LOG_ID_SENSOR_REINIT_OK,
+  LOG_ID_SENSOR_ENABLED,
+  LOG_ID_SENSOR_DISABLED,
+  LOG_ID_SENSOR_IDLE_ENTER,
+  LOG_ID_SENSOR_WAKE_MOTION,
+  /* Environmental sensors */
+  LOG_ID_ENV_INIT_FAILED,
+  LOG_ID_ENV_READ_FAILED,
+  /* Logging subsystem */
+  LOG_ID_LOG_OVERFLOW,
+  /* Latency histograms */
+  LOG_ID_LATENCY_STATS,
+  /* Watchdog supervision */
+  LOG_ID_WATCHDOG_TASK_STALLED,
+  LOG_ID_WATCHDOG_RESET_RECOVERY,
+  /* Boot metrics */
+  LOG_ID_BOOT_FIRST_SAMPLE,
+  /* Control loop */
+  LOG_ID_CONTROL_DEADLINE_MISS,
+  /* Capture / replay harness */
+  LOG_ID_REPLAY_CAPTURE_ACCEL,
+  LOG_ID_REPLAY_CAPTURE_GYRO,
+  LOG_ID_REPLAY_PASS_COMPLETE,
+  /* Profiling */
+  LOG_ID_PROFILING_SNAPSHOT_FAILED,
+  LOG_ID_MAX
+} LogId_t;
+
+/* One binary log record as streamed over the wire */
+typedef struct {
+  uint16_t magic;           // LOG_RECORD_MAGIC
+  uint16_t id;              // LogId_t
+  uint32_t timestamp;       // Tick count at enqueue time
+  uint32_t arg0;
+  uint32_t arg1;
+} LogRecord_t;
+
+/* Exported constants --------------------------------------------------------*/
+#define LOG_RECORD_MAGIC            0x5AA5
+#define LOG_RING_RECORDS            64    // Static ring capacity (power of two)
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize the logging subsystem (UART TX DMA channel)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Log_Init(void);
+
+/**
+ * @brief  Create the background log drain task
+ * @retval BaseType_t
+ */
+BaseType_t Log_CreateTask(void);
+
+/**
+ * @brief  Enqueue a log record (hot-path safe, no formatting or UART access)
+ * @param  id: log event ID
+ * @param  arg0: raw argument 0 (meaning defined per ID in the decoder)
+ * @param  arg1: raw argument 1
+ * @retval None
+ */
+void Log_Write(LogId_t id, uint32_t arg0, uint32_t arg1);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FASTLOG_H */
@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file           : itm_trace.c
+ * @brief          : SWO/ITM event trace implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Enables the ITM stimulus ports used by the TRACE_xxx
+ *                   macros (itm_trace.h) and provides the out-of-line hook
+ *                   functions that FreeRTOSConfig.h wires into the kernel
+ *                   trace macros. The SWO pin itself (PB3) and the TPIU
+ *                   prescaler are configured by the debug probe on attach;
+ *                   with no probe present every emit collapses to a couple
+ *                   of loads and a skipped store.
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "itm_trace.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Stimulus ports to unlock at init (bit per port) */
+#define ITM_TRACE_PORT_MASK         ((1UL << ITM_PORT_SCHED) | \
+                                     (1UL << ITM_PORT_QUEUE) | \
+                                     (1UL << ITM_PORT_I2C) | \
+                                     (1UL << ITM_PORT_SAMPLE))
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Enable the ITM and the trace stimulus ports
+ * @retval None
+ */
+void ITMTrace_Init(void)
+{
+#if ITM_TRACE_ENABLE
+  /* Trace subsystem clock gate (shared with the DWT cycle counter) */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+  /* Enable the ITM and open the event stimulus ports; the probe sets up
+   * the SWO baud rate and TPIU framing when it attaches */
+  ITM->TCR |= ITM_TCR_ITMENA_Msk;
+  ITM->TER |= ITM_TRACE_PORT_MASK;
+#endif
+}
+
+/**
+ * @brief  traceTASK_SWITCHED_IN hook body (FreeRTOSConfig.h)
+ * @param  task_number: uxTCBNumber of the task being switched in
+ * @retval None
+ */
+void vTraceTaskSwitchedIn(uint32_t task_number)
+{
+#if ITM_TRACE_ENABLE
+  ITMTrace_Emit(ITM_PORT_SCHED, TRACE_EVT_TASK_IN, task_number);
+#else
+  (void)task_number;
+#endif
+}
+
+/**
+ * @brief  traceQUEUE_SEND / traceQUEUE_SEND_FROM_ISR hook body
+ * @param  queue_number: uxQueueNumber of the queue
+ * @retval None
+ */
+void vTraceQueueSend(uint32_t queue_number)
+{
+#if ITM_TRACE_ENABLE
+  ITMTrace_Emit(ITM_PORT_QUEUE, TRACE_EVT_QUEUE_SEND, queue_number);
+#else
+  (void)queue_number;
+#endif
+}
+
+/**
+ * @brief  traceQUEUE_RECEIVE hook body
+ * @param  queue_number: uxQueueNumber of the queue
+ * @retval None
+ */
+void vTraceQueueReceive(uint32_t queue_number)
+{
+#if ITM_TRACE_ENABLE
+  ITMTrace_Emit(ITM_PORT_QUEUE, TRACE_EVT_QUEUE_RECV, queue_number);
+#else
+  (void)queue_number;
+#endif
+}
+
+/**
+ * @brief  traceQUEUE_SEND_FAILED hook body
+ * @param  queue_number: uxQueueNumber of the queue
+ * @retval None
+ */
+void vTraceQueueSendFailed(uint32_t queue_number)
+{
+#if ITM_TRACE_ENABLE
+  ITMTrace_Emit(ITM_PORT_QUEUE, TRACE_EVT_QUEUE_SEND_FAIL, queue_number);
+#else
+  (void)queue_number;
+#endif
+}
@@ -0,0 +1,102 @@
+/**
+ ******************************************************************************
+ * @file           : itm_trace.h
+ * @brief          : SWO/ITM event trace header file
+ ******************************************************************************
+ * @description    : Zero-overhead event tracing over the SWO pin
+ *                  - One 32-bit word per event written to an ITM stimulus
+ *                    port: a few cycles when the debug probe is attached,
+ *                    a single load-and-skip when it is not
+ *                  - Events never block: if the stimulus FIFO is full the
+ *                    word is dropped, so tracing cannot perturb the timing
+ *                    it observes
+ *                  - Categories map to separate stimulus ports so the host
+ *                    can filter per subsystem; decoded by
+ *                    tools/itm_trace_decode.py
+ *                  - FreeRTOS scheduler/queue hooks are wired in
+ *                    FreeRTOSConfig.h (traceTASK_SWITCHED_IN, traceQUEUE_*)
+ ******************************************************************************
+ */
+
+#ifndef __ITM_TRACE_H
+#define __ITM_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Compile-time master switch: 0 removes every macro and hook body */
+#ifndef ITM_TRACE_ENABLE
+#define ITM_TRACE_ENABLE            1
+#endif
+
+/* Stimulus port per event category (port 0 left free for printf-style use) */
+#define ITM_PORT_SCHED              1   // Task switches
+#define ITM_PORT_QUEUE              2   // Queue send/receive
+#define ITM_PORT_I2C                3   // I2C transaction start/complete
+#define ITM_PORT_SAMPLE             4   // Sample pipeline boundaries
+
+/* Event IDs (top byte of the trace word; low 24 bits carry the payload) */
+#define TRACE_EVT_TASK_IN           0x01  // payload = task number
+#define TRACE_EVT_QUEUE_SEND        0x02  // payload = queue number
+#define TRACE_EVT_QUEUE_RECV        0x03  // payload = queue number
+#define TRACE_EVT_QUEUE_SEND_FAIL   0x04  // payload = queue number
+#define TRACE_EVT_I2C_START         0x05  // payload = device address
+#define TRACE_EVT_I2C_DONE          0x06  // payload = HAL status
+#define TRACE_EVT_SAMPLE_START      0x07  // payload = tick (low 24 bits)
+#define TRACE_EVT_SAMPLE_DONE       0x08  // payload = tick (low 24 bits)
+
+/* Exported macro ------------------------------------------------------------*/
+
+#if ITM_TRACE_ENABLE
+
+/**
+ * @brief  Emit one event word on a stimulus port (wait-free, drops on full)
+ * @param  port: stimulus port number
+ * @param  evt: event ID (TRACE_EVT_xxx)
+ * @param  payload: low 24 bits of context
+ * @retval None
+ */
+static inline void ITMTrace_Emit(uint32_t port, uint32_t evt, uint32_t payload)
+{
+  /* Port reads 0 while the previous word is still draining; skipping the
+   * write instead of spinning keeps the hot path constant-time */
+  if ((ITM->TCR & ITM_TCR_ITMENA_Msk) != 0 &&
+      (ITM->TER & (1UL << port)) != 0 &&
+      ITM->PORT[port].u32 != 0) {
+    ITM->PORT[port].u32 = (evt << 24) | (payload & 0x00FFFFFFUL);
+  }
+}
+
+#define TRACE_I2C_START(dev_addr)   ITMTrace_Emit(ITM_PORT_I2C, TRACE_EVT_I2C_START, (dev_addr))
+#define TRACE_I2C_DONE(status)      ITMTrace_Emit(ITM_PORT_I2C, TRACE_EVT_I2C_DONE, (status))
+#define TRACE_SAMPLE_START(tick)    ITMTrace_Emit(ITM_PORT_SAMPLE, TRACE_EVT_SAMPLE_START, (tick))
+#define TRACE_SAMPLE_DONE(tick)     ITMTrace_Emit(ITM_PORT_SAMPLE, TRACE_EVT_SAMPLE_DONE, (tick))
+
+#else
+
+#define TRACE_I2C_START(dev_addr)   ((void)0)
+#define TRACE_I2C_DONE(status)      ((void)0)
+#define TRACE_SAMPLE_START(tick)    ((void)0)
+#define TRACE_SAMPLE_DONE(tick)     ((void)0)
+
+#endif /* ITM_TRACE_ENABLE */
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Enable the ITM and the trace stimulus ports
+ * @retval None
+ */
+void ITMTrace_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ITM_TRACE_H */
@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ * @file           : latency.c
+ * @brief          : Per-stage latency histogram implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Compact log-bucketed latency accounting on top of the
+ *                   DWT cycle counter (profiling.c). One observation costs a
+ *                   subtraction, a CLZ and an increment - cheap enough for
+ *                   the 100Hz acquisition loop. Averages hide tail latency,
+ *                   so reporting is percentile-based (p50/p99).
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "latency.h"
+#include "profiling.h"
+#include "fastlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* One log-bucketed histogram: bucket k counts observations whose
+ * microsecond value has its highest set bit at position k */
+typedef struct {
+  uint32_t buckets[LATENCY_BUCKETS];
+  uint32_t count;
+} LatHistogram_t;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static LatHistogram_t xHistograms[LAT_STAGE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Latency_BucketIndex(uint32_t us);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Reset all stage histograms
+ * @retval None
+ */
+void Latency_Reset(void)
+{
+  memset(xHistograms, 0, sizeof(xHistograms));
+}
+
+/**
+ * @brief  Record one latency observation for a stage
+ * @param  stage: pipeline stage
+ * @param  start_cycles: DWT cycle stamp taken when the stage began
+ * @retval None
+ */
+void Latency_Record(LatStage_t stage, uint32_t start_cycles)
+{
+  uint32_t cycles, us;
+
+  if (stage >= LAT_STAGE_MAX) {
+    return;
+  }
+
+  /* 周期数转微秒 (80MHz -> 80 cycles/us) */
+  cycles = Profiling_GetCycles() - start_cycles;
+  us = cycles / (SystemCoreClock / 1000000U);
+
+  xHistograms[stage].buckets[Latency_BucketIndex(us)]++;
+  xHistograms[stage].count++;
+}
+
+/**
+ * @brief  Extract a percentile from a stage histogram
+ * @param  stage: pipeline stage
+ * @param  percentile: requested percentile (e.g. 50, 99)
+ * @retval Bucket upper bound in microseconds, 0 if no samples
+ */
+uint32_t Latency_GetPercentileUs(LatStage_t stage, uint8_t percentile)
+{
+  uint32_t threshold, cumulative = 0;
+
+  if (stage >= LAT_STAGE_MAX || xHistograms[stage].count == 0) {
+    return 0;
+  }
+
+  /* 第一个累计数达到阈值的桶, 上界即该百分位的保守估计。桶k覆盖
+   * [2^k, 2^(k+1)), 所以上界是2^(k+1) - 返回2^k会低估至多一倍 */
+  threshold = ((uint64_t)xHistograms[stage].count * percentile + 99) / 100;
+  for (uint32_t k = 0; k < LATENCY_BUCKETS; k++) {
+    cumulative += xHistograms[stage].buckets[k];
+    if (cumulative >= threshold) {
+      return 1UL << (k + 1);
+    }
+  }
+  return 1UL << LATENCY_BUCKETS;
+}
+
+/**
+ * @brief  Emit per-stage p50/p99 log records for all stages with samples
+ * @retval None
+ */
+void Latency_Report(void)
+{
+  for (uint32_t stage = 0; stage < LAT_STAGE_MAX; stage++) {
+    if (xHistograms[stage].count == 0) {
+      continue;
+    }
+    /* arg0 = stage in the top byte + p50 below, arg1 = p99 (us) */
+    Log_Write(LOG_ID_LATENCY_STATS,
+              (stage << 24) | (Latency_GetPercentileUs(stage, 50) & 0x00FFFFFF),
+              Latency_GetPercentileUs(stage, 99));
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Map a microsecond value to its log2 bucket
+ * @param  us: observed latency in microseconds
+ * @retval Bucket index
+ */
+static uint32_t Latency_BucketIndex(uint32_t us)
+{
+  uint32_t k;
+
+  if (us == 0) {
+    return 0;
+  }
+  k = 31U - (uint32_t)__builtin_clz(us);
+  if (k >= LATENCY_BUCKETS) {
+    k = LATENCY_BUCKETS - 1;
+  }
+  return k;
+}
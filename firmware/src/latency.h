@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file           : latency.h
+ * @brief          : Per-stage latency histogram header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : On-device latency instrumentation for the
+ *                   sample-to-publish path
+ *                  - Log-bucketed (power-of-two) histograms in microseconds,
+ *                    one per pipeline stage, constant memory per stage
+ *                  - Percentile extraction (p50/p99) from the bucket counts,
+ *                    so the <50ms latency target can be verified on-target
+ *                    instead of from broker-side arrival jitter
+ *                  - Stats exported periodically as LOG_ID_LATENCY_STATS
+ *                    records on the binary log/telemetry channel
+ ******************************************************************************
+ */
+
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Pipeline stages - each measures the time spent inside that stage.
+ * Fusion/telemetry/publish hooks come online with their modules. */
+typedef enum {
+  LAT_STAGE_ACQUISITION = 0,    // Sample read until ring commit + queue send
+  LAT_STAGE_FUSION,             // Ring index receive until fusion output
+  LAT_STAGE_TELEMETRY,          // Telemetry frame build until enqueue
+  LAT_STAGE_PUBLISH,            // Enqueue until publish complete
+  LAT_STAGE_MAX
+} LatStage_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Bucket k counts samples in [2^k, 2^(k+1)) microseconds; 20 buckets
+ * cover up to ~1s which is far beyond any sane stage latency */
+#define LATENCY_BUCKETS             20
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Reset all stage histograms
+ * @retval None
+ */
+void Latency_Reset(void);
+
+/**
+ * @brief  Record one latency observation for a stage
+ * @param  stage: pipeline stage
+ * @param  start_cycles: DWT cycle stamp taken when the stage began
+ * @retval None
+ */
+void Latency_Record(LatStage_t stage, uint32_t start_cycles);
+
+/**
+ * @brief  Extract a percentile from a stage histogram
+ * @param  stage: pipeline stage
+ * @param  percentile: requested percentile (e.g. 50, 99)
+ * @retval Bucket upper bound in microseconds, 0 if no samples
+ */
+uint32_t Latency_GetPercentileUs(LatStage_t stage, uint8_t percentile);
+
+/**
+ * @brief  Emit per-stage p50/p99 log records for all stages with samples
+ * @retval None
+ */
+void Latency_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LATENCY_H */
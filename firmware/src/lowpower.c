@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @file           : lowpower.c
+ * @brief          : STOP2 tickless idle implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Implements vLowPowerSuppressTicksAndSleep, installed as
+ *                   portSUPPRESS_TICKS_AND_SLEEP in FreeRTOSConfig.h. Between
+ *                   100Hz sample periods the core is idle ~90% of the time;
+ *                   instead of burning that window in sleep mode with SysTick
+ *                   waking us every millisecond, long idle periods stop the
+ *                   tick, arm LPTIM1 (LSE-clocked, keeps running in STOP2)
+ *                   for the next task deadline and drop into STOP2. On wake
+ *                   the PLL and peripheral kernel clocks are restored and the
+ *                   missed ticks are credited back with vTaskStepTick, so the
+ *                   scheduler timebase never drifts.
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lowpower.h"
+#include "task.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+
+/* Tick <-> LPTIM count conversion (32768Hz LSE, 1000Hz tick) */
+#define LOWPOWER_TICKS_TO_COUNTS(t) (((uint32_t)(t) * LOWPOWER_LPTIM_CLOCK_HZ) / configTICK_RATE_HZ)
+#define LOWPOWER_COUNTS_TO_TICKS(c) (((uint32_t)(c) * configTICK_RATE_HZ) / LOWPOWER_LPTIM_CLOCK_HZ)
+
+/* Private variables ---------------------------------------------------------*/
+static LPTIM_HandleTypeDef hlptim1;
+static LowPowerStats_t xLowPowerStats = {0};
+
+/* Set by the LPTIM compare ISR: distinguishes a deadline wakeup from an
+ * early wakeup by another interrupt (EXTI, DMA, UART) */
+static volatile uint8_t ucDeadlineWakeup = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void LowPower_RestoreClocks(void);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Initialize LPTIM1 as the STOP2 wakeup timer
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LowPower_Init(void)
+{
+  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+
+  /* LPTIM1 kernel clock from LSE: already running (RTC), keeps counting in
+   * STOP2 and costs nothing extra */
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_LPTIM1;
+  PeriphClkInit.Lptim1ClockSelection = RCC_LPTIM1CLKSOURCE_LSE;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK) {
+    return HAL_ERROR;
+  }
+
+  __HAL_RCC_LPTIM1_CLK_ENABLE();
+
+  hlptim1.Instance = LPTIM1;
+  hlptim1.Init.Clock.Source = LPTIM_CLOCKSOURCE_APBCLOCK_LPOSC;
+  hlptim1.Init.Clock.Prescaler = LPTIM_PRESCALER_DIV1;
+  hlptim1.Init.Trigger.Source = LPTIM_TRIGSOURCE_SOFTWARE;
+  hlptim1.Init.OutputPolarity = LPTIM_OUTPUTPOLARITY_HIGH;
+  hlptim1.Init.UpdateMode = LPTIM_UPDATE_IMMEDIATE;
+  hlptim1.Init.CounterSource = LPTIM_COUNTERSOURCE_INTERNAL;
+  hlptim1.Init.Input1Source = LPTIM_INPUT1SOURCE_GPIO;
+  hlptim1.Init.Input2Source = LPTIM_INPUT2SOURCE_GPIO;
+  if (HAL_LPTIM_Init(&hlptim1) != HAL_OK) {
+    return HAL_ERROR;
+  }
+
+  /* Wakeup interrupt must be able to exit STOP2; priority below
+   * configMAX_SYSCALL so the ISR may use FreeRTOS APIs if ever needed */
+  HAL_NVIC_SetPriority(LPTIM1_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Tickless idle entry point (portSUPPRESS_TICKS_AND_SLEEP)
+ * @param  xExpectedIdleTime: idle ticks until the next task deadline
+ * @retval None
+ */
+void vLowPowerSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+  uint32_t ulCounter, ulSleptTicks;
+
+  /* A single STOP2 period is bounded by the 16-bit LPTIM counter; longer
+   * idle just re-enters through the idle task */
+  if (xExpectedIdleTime > LOWPOWER_MAX_SLEEP_TICKS) {
+    xExpectedIdleTime = LOWPOWER_MAX_SLEEP_TICKS;
+  }
+
+  /* Stop the tick so it cannot fire between the sleep decision and WFI */
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+  __disable_irq();
+
+  if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+    /* An event arrived after the idle task committed to sleeping */
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    xLowPowerStats.aborted_entries++;
+    __enable_irq();
+    return;
+  }
+
+  if (xExpectedIdleTime < LOWPOWER_MIN_STOP2_TICKS) {
+    /* Too short to amortize the STOP2 round trip: plain sleep keeps the
+     * SysTick timebase intact and the next tick wakes us */
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    xLowPowerStats.wfi_entries++;
+    __enable_irq();
+    __WFI();
+    return;
+  }
+
+  /* Arm the LPTIM compare at the next deadline and enter STOP2. WFI wakes
+   * on any pending interrupt even with PRIMASK set; the ISR itself runs
+   * only after interrupts are re-enabled below. */
+  ucDeadlineWakeup = 0;
+  HAL_LPTIM_TimeOut_Start_IT(&hlptim1, 0xFFFF,
+                             LOWPOWER_TICKS_TO_COUNTS(xExpectedIdleTime));
+  xLowPowerStats.stop2_entries++;
+
+  HAL_PWREx_EnterSTOP2Mode(PWR_STOPENTRY_WFI);
+
+  /* STOP2 exits on MSI: restore the PLL/80MHz tree and the peripheral
+   * kernel clocks before any ISR or task touches I2C2/USART1 */
+  LowPower_RestoreClocks();
+
+  /* Let the wakeup ISR run (sets ucDeadlineWakeup if it was the LPTIM
+   * compare), then mask again while the tick count is corrected */
+  __enable_irq();
+  __disable_irq();
+
+  ulCounter = HAL_LPTIM_ReadCounter(&hlptim1);
+  HAL_LPTIM_TimeOut_Stop_IT(&hlptim1);
+
+  if (ucDeadlineWakeup) {
+    ulSleptTicks = xExpectedIdleTime;
+  } else {
+    /* Early wakeup (EXTI, UART...): credit only whole elapsed ticks, the
+     * remainder is absorbed by the restarted SysTick period */
+    ulSleptTicks = LOWPOWER_COUNTS_TO_TICKS(ulCounter);
+    if (ulSleptTicks > xExpectedIdleTime) {
+      ulSleptTicks = xExpectedIdleTime;
+    }
+    xLowPowerStats.early_wakeups++;
+  }
+
+  vTaskStepTick(ulSleptTicks);
+  xLowPowerStats.ticks_slept += ulSleptTicks;
+
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  __enable_irq();
+}
+
+/**
+ * @brief  Get low-power statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void LowPower_GetStats(LowPowerStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xLowPowerStats, sizeof(LowPowerStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Restore the system clock tree and peripheral state after STOP2
+ * @retval None
+ */
+static void LowPower_RestoreClocks(void)
+{
+  /* Re-run the boot clock configuration: HSI on, PLL relocked, SYSCLK back
+   * to 80MHz. LSE and the RTC ran through STOP2 untouched. */
+  SystemClock_Config();
+
+  /* I2C2/USART1 registers are retained in STOP2, but their timing/baud
+   * configuration assumes the full-speed kernel clocks - re-init so a
+   * transfer started right after wakeup sees consistent state */
+  HAL_I2C_Init(&hi2c2);
+  HAL_UART_Init(&huart1);
+}
+
+/**
+ * @brief  LPTIM1 compare match callback (STOP2 deadline wakeup)
+ * @param  hlptim: LPTIM handle
+ * @retval None
+ */
+void HAL_LPTIM_CompareMatchCallback(LPTIM_HandleTypeDef *hlptim)
+{
+  (void)hlptim;
+  ucDeadlineWakeup = 1;
+}
+
+/**
+ * @brief  LPTIM1 interrupt handler
+ * @retval None
+ */
+void LPTIM1_IRQHandler(void)
+{
+  HAL_LPTIM_IRQHandler(&hlptim1);
+}
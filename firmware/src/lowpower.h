@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ * @file           : lowpower.h
+ * @brief          : Tickless idle / STOP2 power management header file
+ ******************************************************************************
+ * @description    : STOP2-based tickless idle for the FreeRTOS scheduler
+ *                  - Overrides portSUPPRESS_TICKS_AND_SLEEP (FreeRTOSConfig.h)
+ *                    so idle periods longer than a few ticks enter STOP2
+ *                    instead of spinning SysTick through an empty WFI
+ *                  - LPTIM1 clocked from LSE keeps counting through STOP2
+ *                    and fires the wakeup compare at the next task deadline;
+ *                    early wakeups (EXTI, I2C address match) are credited
+ *                    from the LPTIM counter via vTaskStepTick
+ *                  - System clock (PLL/80MHz) and the I2C2/USART1 kernel
+ *                    clocks are restored before returning to the scheduler
+ ******************************************************************************
+ */
+
+#ifndef __LOWPOWER_H
+#define __LOWPOWER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "FreeRTOS.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Low-power statistics */
+typedef struct {
+  uint32_t stop2_entries;       // Idle periods spent in STOP2
+  uint32_t wfi_entries;         // Idle periods too short for STOP2 (plain WFI)
+  uint32_t aborted_entries;     // Sleeps aborted by a late-arriving event
+  uint32_t early_wakeups;       // STOP2 exits before the LPTIM deadline
+  uint32_t ticks_slept;         // Total ticks credited via vTaskStepTick
+} LowPowerStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* LPTIM1 wakeup timer runs from LSE and keeps counting in STOP2 */
+#define LOWPOWER_LPTIM_CLOCK_HZ     32768
+
+/* Idle periods shorter than this stay in sleep mode: the STOP2 round trip
+ * (regulator ramp + HSI restart + PLL relock + peripheral clock restore)
+ * costs more than it saves below a few milliseconds */
+#define LOWPOWER_MIN_STOP2_TICKS    3
+
+/* 16-bit LPTIM counter bounds a single STOP2 period (~2s at 32768Hz) */
+#define LOWPOWER_MAX_SLEEP_TICKS    ((0xFFFFUL * configTICK_RATE_HZ) / LOWPOWER_LPTIM_CLOCK_HZ)
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize LPTIM1 as the STOP2 wakeup timer
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef LowPower_Init(void);
+
+/**
+ * @brief  Tickless idle entry point (portSUPPRESS_TICKS_AND_SLEEP)
+ * @param  xExpectedIdleTime: idle ticks until the next task deadline
+ * @retval None
+ */
+void vLowPowerSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
+
+/**
+ * @brief  Get low-power statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void LowPower_GetStats(LowPowerStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOWPOWER_H */
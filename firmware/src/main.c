@@ -22,11 +22,23 @@
 #include "timers.h"
 
 /* Private includes ----------------------------------------------------------*/
+#include "i2c_bus.h"
+#include "sensor_ring.h"
+#include "fastlog.h"
+#include "profiling.h"
+#include "latency.h"
 #include "sensor_acq.h"
 #include "fusion.h"
 #include "control.h"
 #include "telemetry.h"
+#include "rate_group.h"
 #include "watchdog.h"
+#include "mqtt_client.h"
+#include "lowpower.h"
+#include "itm_trace.h"
+#ifdef BENCH_BUILD
+#include "bench.h"
+#endif
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -43,6 +55,7 @@ RTC_HandleTypeDef hrtc;
 /* FreeRTOS handles */
 TaskHandle_t xMainTaskHandle = NULL;
 QueueHandle_t xSensorDataQueue = NULL;
+QueueHandle_t xSensorMailbox = NULL;
 QueueHandle_t xControlQueue = NULL;
 QueueHandle_t xTelemetryQueue = NULL;
 SemaphoreHandle_t xI2CMutex = NULL;
@@ -51,8 +64,26 @@ SemaphoreHandle_t xI2CMutex = NULL;
 volatile uint32_t ulSystemTicks = 0;
 volatile uint8_t ucSystemReady = 0;
 
+/* Static allocation buffers for kernel objects - no heap involved */
+static StaticTask_t xMainTaskTCB;
+static StackType_t xMainTaskStack[MAIN_TASK_STACK_SIZE];
+static StaticQueue_t xSensorDataQueueBuffer;
+static uint8_t ucSensorDataQueueStorage[10 * sizeof(SensorRingIndex_t)];
+static StaticQueue_t xSensorMailboxBuffer;
+static uint8_t ucSensorMailboxStorage[1 * sizeof(SensorRingIndex_t)];
+static StaticQueue_t xControlQueueBuffer;
+static uint8_t ucControlQueueStorage[5 * sizeof(ControlCmd_t)];
+static StaticQueue_t xTelemetryQueueBuffer;
+static uint8_t ucTelemetryQueueStorage[20 * sizeof(TelemetryData_t)];
+static StaticSemaphore_t xI2CMutexBuffer;
+
+/* Static memory for the kernel's own idle and timer service tasks */
+static StaticTask_t xIdleTaskTCB;
+static StackType_t xIdleTaskStack[configMINIMAL_STACK_SIZE];
+static StaticTask_t xTimerTaskTCB;
+static StackType_t xTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+
 /* Private function prototypes -----------------------------------------------*/
-void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_I2C2_Init(void);
 static void MX_USART1_UART_Init(void);
@@ -81,24 +112,41 @@ int main(void)
   MX_USART1_UART_Init();
   MX_RTC_Init();
 
+  /* Open the SWO event trace ports before the scheduler starts so the
+   * first context switches are already visible to an attached probe */
+  ITMTrace_Init();
+
   /* Create FreeRTOS objects */
   
-  /* Create queues for inter-task communication */
-  xSensorDataQueue = xQueueCreate(10, sizeof(SensorData_t));
-  xControlQueue = xQueueCreate(5, sizeof(ControlCmd_t));
-  xTelemetryQueue = xQueueCreate(20, sizeof(TelemetryData_t));
-  
+  /* Create queues for inter-task communication from static buffers. Sensor
+   * samples live in the static ring buffer (sensor_ring.c); only slot
+   * indexes travel through the queue, so no SensorData_t is ever copied
+   * between tasks. */
+  xSensorDataQueue = xQueueCreateStatic(10, sizeof(SensorRingIndex_t),
+                                        ucSensorDataQueueStorage, &xSensorDataQueueBuffer);
+  /* Latest-value mailbox for the control path: the producer overwrites the
+   * pending index instead of blocking, so control always sees the newest
+   * sample and the acquisition loop never stalls on a slow consumer */
+  xSensorMailbox = xQueueCreateStatic(1, sizeof(SensorRingIndex_t),
+                                      ucSensorMailboxStorage, &xSensorMailboxBuffer);
+  xControlQueue = xQueueCreateStatic(5, sizeof(ControlCmd_t),
+                                     ucControlQueueStorage, &xControlQueueBuffer);
+  xTelemetryQueue = xQueueCreateStatic(20, sizeof(TelemetryData_t),
+                                       ucTelemetryQueueStorage, &xTelemetryQueueBuffer);
+
   /* Create mutex for I2C bus protection */
-  xI2CMutex = xSemaphoreCreateMutex();
-  
-  if (xSensorDataQueue == NULL || xControlQueue == NULL || 
+  xI2CMutex = xSemaphoreCreateMutexStatic(&xI2CMutexBuffer);
+
+  if (xSensorDataQueue == NULL || xSensorMailbox == NULL || xControlQueue == NULL ||
       xTelemetryQueue == NULL || xI2CMutex == NULL) {
     Error_Handler();
   }
 
   /* Create the main system task */
-  if (xTaskCreate(MainTask, "MainTask", MAIN_TASK_STACK_SIZE, NULL, 
-                  MAIN_TASK_PRIORITY, &xMainTaskHandle) != pdPASS) {
+  xMainTaskHandle = xTaskCreateStatic(MainTask, "MainTask", MAIN_TASK_STACK_SIZE,
+                                      NULL, MAIN_TASK_PRIORITY,
+                                      xMainTaskStack, &xMainTaskTCB);
+  if (xMainTaskHandle == NULL) {
     Error_Handler();
   }
 
@@ -118,12 +166,59 @@ int main(void)
   */
 void MainTask(void *pvParameters)
 {
-  /* Initialize sensor drivers */
+  /* Initialize the non-blocking I2C transfer engine and its bus-owner task */
+  if (I2CBus_Init() != HAL_OK) {
+    Error_Handler();
+  }
+  if (I2CBus_CreateTask() != pdPASS) {
+    Error_Handler();
+  }
+
+#ifdef BENCH_BUILD
+  /* Benchmark firmware (python build.py bench): bus engine + IMU + bench
+   * task only. The pipeline tasks are not created so every measurement
+   * runs on an otherwise idle system, and the bench task owns the UART
+   * (no log drain DMA competing for it). */
+  if (Log_Init() != HAL_OK) {
+    Error_Handler();
+  }
   if (SensorAcq_Init() != HAL_OK) {
     Error_Handler();
   }
+  if (Bench_CreateTask() != pdPASS) {
+    Error_Handler();
+  }
 
-  /* Create sensor acquisition task */
+  ucSystemReady = 1;
+  for (;;) {
+    HAL_GPIO_TogglePin(GPIOB, GPIO_PIN_14); // Green LED
+    vTaskDelay(pdMS_TO_TICKS(1000));
+  }
+#else
+
+  /* Initialize binary logging and its background drain task */
+  if (Log_Init() != HAL_OK) {
+    Error_Handler();
+  }
+  if (Log_CreateTask() != pdPASS) {
+    Error_Handler();
+  }
+
+#if RATE_GROUP_SCHEDULER
+  /* Rate-group executive: acquisition, fusion, control and telemetry run
+   * as phases of one 100Hz dispatcher on a single stack (rate_group.c).
+   * Sensor driver bring-up still happens inside the dispatcher task and
+   * overlaps with the task creation below. */
+  if (RateGroup_CreateTask() != pdPASS) {
+    Error_Handler();
+  }
+#else
+  /* Fast boot: create every pipeline task immediately and let each
+   * subsystem initialize concurrently in its own context. Sensor driver
+   * bring-up (including the 10ms LSM6DSL reset wait) runs inside
+   * SensorAcqTask and overlaps with the task creation below, instead of
+   * serializing the whole pipeline behind it. SensorAcqTask reports
+   * time-to-first-valid-sample once the first sample is committed. */
   if (SensorAcq_CreateTask() != pdPASS) {
     Error_Handler();
   }
@@ -142,26 +237,56 @@ void MainTask(void *pvParameters)
   if (Telemetry_CreateTask() != pdPASS) {
     Error_Handler();
   }
+#endif /* RATE_GROUP_SCHEDULER */
+
+  /* Create the MQTT connection task - Wi-Fi join, broker handshake and
+   * keepalive run here at low priority, off the telemetry publish path */
+  if (MQTT_CreateTask() != pdPASS) {
+    Error_Handler();
+  }
 
   /* Create watchdog task */
   if (Watchdog_CreateTask() != pdPASS) {
     Error_Handler();
   }
 
+  /* Arm the STOP2 tickless-idle wakeup timer - from here on, idle periods
+   * longer than a few ticks power the core down between sample periods */
+  if (LowPower_Init() != HAL_OK) {
+    Error_Handler();
+  }
+
   /* System ready flag */
   ucSystemReady = 1;
   
   /* Main task loop - system status monitoring */
+  TelemetryData_t heartbeat = {0};
+  Latency_Reset();
   for (;;) {
     /* Update system ticks */
     ulSystemTicks = xTaskGetTickCount();
-    
+
     /* System status LED blink */
     HAL_GPIO_TogglePin(GPIOB, GPIO_PIN_14); // Green LED
-    
+
+    /* System health heartbeat - CPU load from the DWT run-time stats */
+    heartbeat.sequence++;
+    heartbeat.timestamp = ulSystemTicks;
+    heartbeat.sensor_index = 0;
+    heartbeat.system_status = ucSystemReady;
+    heartbeat.cpu_usage = Profiling_GetCPUUsage();
+    heartbeat.free_heap = xPortGetFreeHeapSize();
+    xQueueSend(xTelemetryQueue, &heartbeat, 0);
+
+    /* Per-stage latency percentiles every 10 seconds */
+    if ((heartbeat.sequence % 10U) == 0U) {
+      Latency_Report();
+    }
+
     /* Periodic task - execute every 1 second */
     vTaskDelay(pdMS_TO_TICKS(1000));
   }
+#endif /* BENCH_BUILD */
 }
 
 /**
@@ -326,11 +451,40 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
-  /* EXTI interrupt init*/
-  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 15, 0);
+  /*Configure GPIO pin : PtPin */
+  GPIO_InitStruct.Pin = GPIO_PIN_11; // LSM6DSL INT1 (data-ready)
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(GPIOD, &GPIO_InitStruct);
+
+  /* EXTI interrupt init - INT1 must be able to call FreeRTOS ISR APIs */
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
   HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
 }
 
+/**
+  * @brief  EXTI line[15:10] interrupt handler
+  * @retval None
+  */
+void EXTI15_10_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_11); // LSM6DSL INT1
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_13); // User button
+}
+
+/**
+  * @brief  EXTI line detection callback
+  * @param  GPIO_Pin: pin connected to the EXTI line
+  * @retval None
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == GPIO_PIN_11) {
+    /* IMU data-ready - wake the acquisition task directly */
+    SensorAcq_DataReadyISR();
+  }
+}
+
 /**
   * @brief  This function is executed in case of error occurrence.
   * @retval None
@@ -362,8 +516,27 @@ void vApplicationMallocFailedHook(void)
 
 void vApplicationIdleHook(void)
 {
-  /* Tickless idle for power optimization */
-  __WFI();
+  /* Sleep/STOP2 entry is handled by the tickless path in lowpower.c
+   * (portSUPPRESS_TICKS_AND_SLEEP); nothing to do per idle pass */
+}
+
+/* Static allocation support - supply the memory for the kernel's own tasks */
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,
+                                   StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+  *ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+  *ppxIdleTaskStackBuffer = xIdleTaskStack;
+  *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
+                                    StackType_t **ppxTimerTaskStackBuffer,
+                                    uint32_t *pulTimerTaskStackSize)
+{
+  *ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+  *ppxTimerTaskStackBuffer = xTimerTaskStack;
+  *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
 }
 
 #ifdef  USE_FULL_ASSERT
@@ -20,17 +20,65 @@ extern "C" {
 
 /* Exported types ------------------------------------------------------------*/
 
-/* Sensor data structure */
+/* IMU scale descriptor - physical units per raw count. Samples carry a
+ * scale_id into the shared table (sensor_ring.c) instead of embedding the
+ * factors, so the descriptor costs one byte per sample. */
+typedef struct {
+  float accel_lsb;                     // m/s² per count
+  float gyro_lsb;                      // rad/s per count
+} SensorScale_t;
+
+#define SENSOR_SCALE_SLOTS          2
+
+/* Sensor data structure - IMU axes stay in raw int16 counts end to end;
+ * conversion to physical units happens lazily at the consumers that need
+ * them (fusion, control) via the accessors below, not in the acquisition
+ * hot path. Environmental values convert at their native 1Hz rate where
+ * the cost is noise. Raw layout also halves what moves through the
+ * queues, the telemetry encoder and the flash spool. */
 typedef struct {
   uint32_t timestamp;
-  float accel_x, accel_y, accel_z;    // m/s²
-  float gyro_x, gyro_y, gyro_z;       // rad/s
+  int16_t accel_raw[3];                // Raw counts, scale via scale_id
+  int16_t gyro_raw[3];
   float pressure;                      // hPa
   float temperature;                   // °C
   float humidity;                      // %RH
+  uint8_t scale_id;                    // Index into xSensorScales
   uint8_t data_valid;
 } SensorData_t;
 
+extern SensorScale_t xSensorScales[SENSOR_SCALE_SLOTS];
+
+/**
+ * @brief  Convert a sample's raw accelerometer counts to m/s²
+ * @param  sample: sensor sample
+ * @param  out: float[3] result
+ * @retval None
+ */
+static inline void SensorData_GetAccel(const SensorData_t *sample, float *out)
+{
+  float lsb = xSensorScales[sample->scale_id].accel_lsb;
+
+  out[0] = (float)sample->accel_raw[0] * lsb;
+  out[1] = (float)sample->accel_raw[1] * lsb;
+  out[2] = (float)sample->accel_raw[2] * lsb;
+}
+
+/**
+ * @brief  Convert a sample's raw gyroscope counts to rad/s
+ * @param  sample: sensor sample
+ * @param  out: float[3] result
+ * @retval None
+ */
+static inline void SensorData_GetGyro(const SensorData_t *sample, float *out)
+{
+  float lsb = xSensorScales[sample->scale_id].gyro_lsb;
+
+  out[0] = (float)sample->gyro_raw[0] * lsb;
+  out[1] = (float)sample->gyro_raw[1] * lsb;
+  out[2] = (float)sample->gyro_raw[2] * lsb;
+}
+
 /* Control command structure */
 typedef struct {
   uint8_t cmd_type;
@@ -38,11 +86,12 @@ typedef struct {
   uint32_t timestamp;
 } ControlCmd_t;
 
-/* Telemetry data structure */
+/* Telemetry data structure - references a sensor ring slot by index
+ * (see sensor_ring.h) instead of embedding a SensorData_t copy */
 typedef struct {
   uint32_t sequence;
   uint32_t timestamp;
-  SensorData_t sensor_data;
+  uint16_t sensor_index;
   uint8_t system_status;
   float cpu_usage;
   uint32_t free_heap;
@@ -61,12 +110,25 @@ typedef struct {
 #define LPS22HB_I2C_ADDR           0x5C
 #define HTS221_I2C_ADDR            0x5F
 
+/* Rate-group executive (rate_group.c) - the pipeline rates above are exact
+ * harmonics of SENSOR_SAMPLE_RATE_HZ, so acquisition, fusion, control and
+ * telemetry run as phases of one 100Hz dispatcher task on a single stack
+ * instead of four independently scheduled periodic tasks. Set to 0 to
+ * restore the independent-task scheduling. */
+#ifndef RATE_GROUP_SCHEDULER
+#define RATE_GROUP_SCHEDULER        1
+#endif
+
 /* Task priority definitions */
 #define TASK_PRIORITY_SENSOR       (tskIDLE_PRIORITY + 4)
 #define TASK_PRIORITY_FUSION       (tskIDLE_PRIORITY + 3)
 #define TASK_PRIORITY_CONTROL      (tskIDLE_PRIORITY + 3)
 #define TASK_PRIORITY_TELEMETRY    (tskIDLE_PRIORITY + 2)
 #define TASK_PRIORITY_WATCHDOG     (tskIDLE_PRIORITY + 1)
+#define TASK_PRIORITY_MQTT         (tskIDLE_PRIORITY + 1)
+/* The dispatcher inherits the acquisition priority: its frame start is the
+ * sensor data-ready event, same as the standalone acquisition task */
+#define TASK_PRIORITY_RATE_GROUP   TASK_PRIORITY_SENSOR
 
 /* Task stack size definitions */
 #define TASK_STACK_SIZE_SENSOR     512
@@ -74,11 +136,16 @@ typedef struct {
 #define TASK_STACK_SIZE_CONTROL    256
 #define TASK_STACK_SIZE_TELEMETRY  1024
 #define TASK_STACK_SIZE_WATCHDOG   256
+#define TASK_STACK_SIZE_MQTT       512
+/* Phases run sequentially, so the dispatcher stack is sized for the deepest
+ * phase (telemetry), not the sum of the four task stacks it replaces */
+#define TASK_STACK_SIZE_RATE_GROUP 1024
 
 /* Exported macro ------------------------------------------------------------*/
 
 /* Exported functions prototypes ---------------------------------------------*/
 void Error_Handler(void);
+void SystemClock_Config(void);
 
 /* External variables --------------------------------------------------------*/
 extern I2C_HandleTypeDef hi2c2;
@@ -86,6 +153,7 @@ extern UART_HandleTypeDef huart1;
 extern RTC_HandleTypeDef hrtc;
 
 extern QueueHandle_t xSensorDataQueue;
+extern QueueHandle_t xSensorMailbox;
 extern QueueHandle_t xControlQueue;
 extern QueueHandle_t xTelemetryQueue;
 extern SemaphoreHandle_t xI2CMutex;
@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ * @file           : profiling.c
+ * @brief          : DWT cycle-counter profiling implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Supplies the run-time stats clock that FreeRTOSConfig.h
+ *                   already declares (configureTimerForRunTimeStats /
+ *                   getRunTimeCounterValue) from the Cortex-M4 DWT cycle
+ *                   counter, and adds per-section cycle timers so hot
+ *                   functions like LSM6DSL_ReadData can be measured in place
+ *                   instead of tuning task priorities blind.
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "profiling.h"
+#include "fastlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Run-time stats tick = CYCCNT / 1024 (~78kHz @ 80MHz): fast enough for
+ * percentage resolution, slow enough not to overflow the 32-bit stats
+ * counters within a session */
+#define PROFILING_STATS_SHIFT       10
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ProfSectionStats_t xSectionStats[PROF_SECTION_MAX];
+static uint32_t ulSectionStart[PROF_SECTION_MAX];
+static volatile uint32_t ulContextSwitches = 0;
+
+/* Snapshot of total/idle runtime from the previous CPU usage query */
+static uint32_t ulLastTotalRunTime = 0;
+static uint32_t ulLastIdleRunTime = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Initialize the DWT cycle counter
+ * @retval None
+ */
+void Profiling_Init(void)
+{
+  /* Enable trace subsystem and start the free-running cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  memset(xSectionStats, 0, sizeof(xSectionStats));
+  for (int i = 0; i < PROF_SECTION_MAX; i++) {
+    xSectionStats[i].min_cycles = UINT32_MAX;
+  }
+}
+
+/**
+ * @brief  Read the raw cycle counter
+ * @retval Current DWT->CYCCNT value
+ */
+uint32_t Profiling_GetCycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+ * @brief  Start timing a hot section
+ * @param  section: section identifier
+ * @retval None
+ */
+void Profiling_SectionEnter(ProfSection_t section)
+{
+  if (section < PROF_SECTION_MAX) {
+    ulSectionStart[section] = DWT->CYCCNT;
+  }
+}
+
+/**
+ * @brief  Stop timing a hot section and accumulate statistics
+ * @param  section: section identifier
+ * @retval None
+ */
+void Profiling_SectionExit(ProfSection_t section)
+{
+  uint32_t cycles;
+  ProfSectionStats_t *stats;
+
+  if (section >= PROF_SECTION_MAX) {
+    return;
+  }
+
+  cycles = DWT->CYCCNT - ulSectionStart[section];
+  stats = &xSectionStats[section];
+
+  stats->last_cycles = cycles;
+  stats->total_cycles += cycles;
+  stats->count++;
+  if (cycles < stats->min_cycles) {
+    stats->min_cycles = cycles;
+  }
+  if (cycles > stats->max_cycles) {
+    stats->max_cycles = cycles;
+  }
+}
+
+/**
+ * @brief  Get accumulated statistics for one section
+ * @param  section: section identifier
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Profiling_GetSectionStats(ProfSection_t section, ProfSectionStats_t *stats)
+{
+  if (section < PROF_SECTION_MAX && stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xSectionStats[section], sizeof(ProfSectionStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+/**
+ * @brief  Get total CPU usage (100% minus idle task share) since last call
+ * @retval CPU usage percentage
+ */
+float Profiling_GetCPUUsage(void)
+{
+  static TaskStatus_t xTaskStatus[PROFILING_MAX_TASKS];
+  UBaseType_t task_count;
+  uint32_t total_runtime = 0;
+  uint32_t idle_runtime = 0;
+  uint32_t delta_total, delta_idle;
+
+  task_count = uxTaskGetSystemState(xTaskStatus, PROFILING_MAX_TASKS,
+                                    &total_runtime);
+  if (task_count == 0) {
+    /* Snapshot array too small - the stat would silently read 0%
+     * forever, so make the capacity miss visible once */
+    static uint8_t ucOverflowLogged = 0;
+    if (ucOverflowLogged == 0) {
+      ucOverflowLogged = 1;
+      Log_Write(LOG_ID_PROFILING_SNAPSHOT_FAILED, PROFILING_MAX_TASKS,
+                uxTaskGetNumberOfTasks());
+    }
+    return 0.0f;
+  }
+  if (total_runtime == 0) {
+    return 0.0f;
+  }
+
+  for (UBaseType_t i = 0; i < task_count; i++) {
+    if (strcmp(xTaskStatus[i].pcTaskName, "IDLE") == 0) {
+      idle_runtime = xTaskStatus[i].ulRunTimeCounter;
+      break;
+    }
+  }
+
+  /* Usage over the window since the previous query, not since boot */
+  delta_total = total_runtime - ulLastTotalRunTime;
+  delta_idle = idle_runtime - ulLastIdleRunTime;
+  ulLastTotalRunTime = total_runtime;
+  ulLastIdleRunTime = idle_runtime;
+
+  if (delta_total == 0) {
+    return 0.0f;
+  }
+  return 100.0f * (float)(delta_total - delta_idle) / (float)delta_total;
+}
+
+/**
+ * @brief  Get the context switch count since boot
+ * @retval Context switch count
+ */
+uint32_t Profiling_GetContextSwitchCount(void)
+{
+  return ulContextSwitches;
+}
+
+/**
+ * @brief  FreeRTOS traceTASK_SWITCHED_IN hook (see FreeRTOSConfig.h)
+ * @retval None
+ */
+void vProfilingTaskSwitchedIn(void)
+{
+  ulContextSwitches++;
+}
+
+/* FreeRTOS run-time stats clock (declared in FreeRTOSConfig.h) --------------*/
+
+/**
+ * @brief  Configure the run-time stats timer - DWT is set up in Profiling_Init
+ * @retval None
+ */
+void configureTimerForRunTimeStats(void)
+{
+  Profiling_Init();
+}
+
+/**
+ * @brief  Run-time stats counter value (CYCCNT scaled down to ~78kHz)
+ * @retval Counter value
+ */
+unsigned long getRunTimeCounterValue(void)
+{
+  return (unsigned long)(DWT->CYCCNT >> PROFILING_STATS_SHIFT);
+}
@@ -0,0 +1,109 @@
+/**
+ ******************************************************************************
+ * @file           : profiling.h
+ * @brief          : DWT cycle-counter profiling header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Cycle-accurate runtime profiling on the Cortex-M4 DWT
+ *                  - Drives the FreeRTOS run-time stats clock from DWT->CYCCNT
+ *                  - Per-task CPU percentage and context-switch counting
+ *                  - Per-section cycle timers for hot functions
+ *                  - Results surface through the cpu_usage/free_heap fields
+ *                    of TelemetryData_t on the existing telemetry path
+ ******************************************************************************
+ */
+
+#ifndef __PROFILING_H
+#define __PROFILING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Instrumented hot sections - extend as new hot paths appear */
+typedef enum {
+  PROF_SECTION_IMU_READ = 0,    // LSM6DSL_ReadData / FIFO drain
+  PROF_SECTION_SENSOR_CYCLE,    // Full acquisition cycle
+  PROF_SECTION_MAX
+} ProfSection_t;
+
+/* Accumulated cycle statistics for one section */
+typedef struct {
+  uint32_t count;               // Number of timed executions
+  uint32_t last_cycles;
+  uint32_t min_cycles;
+  uint32_t max_cycles;
+  uint64_t total_cycles;        // For average = total / count
+} ProfSectionStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Snapshot capacity for uxTaskGetSystemState, which returns 0 records
+ * when the array is too small. Worst case is the per-task pipeline
+ * build (RATE_GROUP_SCHEDULER=0): Main, I2CBus, Log, SensorAcq,
+ * Fusion, Control, Telemetry, MQTT, Watchdog plus Idle and Timer = 11,
+ * with headroom for future additions. */
+#define PROFILING_MAX_TASKS         14
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize the DWT cycle counter
+ * @retval None
+ */
+void Profiling_Init(void);
+
+/**
+ * @brief  Read the raw cycle counter
+ * @retval Current DWT->CYCCNT value
+ */
+uint32_t Profiling_GetCycles(void);
+
+/**
+ * @brief  Start timing a hot section
+ * @param  section: section identifier
+ * @retval None
+ */
+void Profiling_SectionEnter(ProfSection_t section);
+
+/**
+ * @brief  Stop timing a hot section and accumulate statistics
+ * @param  section: section identifier
+ * @retval None
+ */
+void Profiling_SectionExit(ProfSection_t section);
+
+/**
+ * @brief  Get accumulated statistics for one section
+ * @param  section: section identifier
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Profiling_GetSectionStats(ProfSection_t section, ProfSectionStats_t *stats);
+
+/**
+ * @brief  Get total CPU usage (100% minus idle task share) since last call
+ * @retval CPU usage percentage
+ */
+float Profiling_GetCPUUsage(void);
+
+/**
+ * @brief  Get the context switch count since boot
+ * @retval Context switch count
+ */
+uint32_t Profiling_GetContextSwitchCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROFILING_H */
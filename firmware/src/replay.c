@@ -0,0 +1,151 @@
+/**
+ ******************************************************************************
+ * @file           : replay.c
+ * @brief          : 传感器流捕获与回放实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 录制/回放数据通路:
+ *                   捕获侧把原始int16样本打包成两条二进制日志记录
+ *                   (加速度计+陀螺仪, 共享序号配对), 复用fastlog的环形
+ *                   缓冲与UART DMA排水通道, 热路径开销就是两次Log_Write;
+ *                   回放侧 (REPLAY_BUILD) 从链接进闪存的数据集逐帧供数,
+ *                   时间戳按采样周期在记录时间域重建, 数据集走完一遍
+ *                   上报一条PASS记录后回绕, 台架上几分钟就能跑完数小时
+ *                   的现场数据。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "replay.h"
+#include "sensor_acq.h"
+#include "fastlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* 捕获样本序号: 两条记录靠它在主机侧重新配对 */
+static uint16_t usCaptureSequence = 0;
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Pack one committed raw sample onto the binary log stream
+ * @param  sample: committed sensor sample
+ * @retval None
+ */
+void Replay_CaptureSample(const SensorData_t *sample)
+{
+  uint32_t arg0, arg1;
+
+  /* 加速度计记录: arg0 = ax|ay, arg1 = az|序号 */
+  arg0 = (uint16_t)sample->accel_raw[0] |
+         ((uint32_t)(uint16_t)sample->accel_raw[1] << 16);
+  arg1 = (uint16_t)sample->accel_raw[2] |
+         ((uint32_t)usCaptureSequence << 16);
+  Log_Write(LOG_ID_REPLAY_CAPTURE_ACCEL, arg0, arg1);
+
+  /* 陀螺仪记录: 同一序号, 主机按序号配对成完整帧 */
+  arg0 = (uint16_t)sample->gyro_raw[0] |
+         ((uint32_t)(uint16_t)sample->gyro_raw[1] << 16);
+  arg1 = (uint16_t)sample->gyro_raw[2] |
+         ((uint32_t)usCaptureSequence << 16);
+  Log_Write(LOG_ID_REPLAY_CAPTURE_GYRO, arg0, arg1);
+
+  usCaptureSequence++;
+}
+
+#ifdef REPLAY_BUILD
+
+/* 回放游标与当前遍统计 */
+static uint32_t ulReplayIndex = 0;
+static uint32_t ulReplayPassStartTick = 0;
+
+/* 内置默认数据集 (弱定义): 少量静止+缓慢转动的合成帧, 保证回放固件
+ * 不带录制数据也能链接运行; 实际测试用
+ * tools/replay_capture.py --emit-c 生成的 replay_data.c 覆盖 */
+__weak const ReplayFrame_t g_xReplayDataset[] = {
+  { {  120,  -45, 16420 }, {   12,   -8,    5 } },
+  { {  118,  -47, 16415 }, {   10,   -6,    4 } },
+  { {  125,  -40, 16428 }, {  240,  -15,   22 } },
+  { {  131,  -38, 16433 }, {  480,  -30,   45 } },
+  { {  140,  -52, 16410 }, {  250,  -12,   20 } },
+  { {  122,  -44, 16418 }, {   15,   -9,    6 } },
+  { {  119,  -46, 16422 }, {   11,   -7,    5 } },
+  { {  121,  -45, 16419 }, {   13,   -8,    4 } },
+};
+__weak const uint32_t g_ulReplayDatasetCount =
+    sizeof(g_xReplayDataset) / sizeof(g_xReplayDataset[0]);
+
+/**
+ * @brief  Reset the replay cursor and pass statistics
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Replay_Init(void)
+{
+  if (g_ulReplayDatasetCount == 0) {
+    return HAL_ERROR;
+  }
+  ulReplayIndex = 0;
+  ulReplayPassStartTick = xTaskGetTickCount();
+  return HAL_OK;
+}
+
+/**
+ * @brief  Get the raw-to-physical scale factors of the recorded data
+ * @param  accel_lsb: accelerometer m/s^2 per LSB
+ * @param  gyro_lsb: gyroscope rad/s per LSB
+ * @retval None
+ */
+void Replay_GetScale(float *accel_lsb, float *gyro_lsb)
+{
+  /* 与lsm6dsl.c相同的换算: mg/LSB -> m/s^2, mdps/LSB -> rad/s */
+  if (accel_lsb != NULL) {
+    *accel_lsb = REPLAY_ACCEL_SENSITIVITY * 9.80665f / 1000.0f;
+  }
+  if (gyro_lsb != NULL) {
+    *gyro_lsb = REPLAY_GYRO_SENSITIVITY * 3.14159f / (180.0f * 1000.0f);
+  }
+}
+
+/**
+ * @brief  Produce the next recorded sample
+ * @param  sample: filled with the recorded frame and a synthetic
+ *         recorded-timeline timestamp
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Replay_ReadSample(LSM6DSL_RawSample_t *sample)
+{
+  const ReplayFrame_t *frame = &g_xReplayDataset[ulReplayIndex % g_ulReplayDatasetCount];
+
+  sample->accel[0] = frame->accel[0];
+  sample->accel[1] = frame->accel[1];
+  sample->accel[2] = frame->accel[2];
+  sample->gyro[0] = frame->gyro[0];
+  sample->gyro[1] = frame->gyro[1];
+  sample->gyro[2] = frame->gyro[2];
+  sample->temperature = 0;
+
+  /* 时间戳在记录时间域重建: 下游融合积分的dt与现场一致 */
+  sample->timestamp = ulReplayIndex * SENSOR_SAMPLE_PERIOD_MS;
+  sample->data_ready = 1;
+
+  ulReplayIndex++;
+  if ((ulReplayIndex % g_ulReplayDatasetCount) == 0) {
+    /* 一遍跑完: 上报样本数与台架耗时, 继续回绕 */
+    uint32_t now = xTaskGetTickCount();
+
+    Log_Write(LOG_ID_REPLAY_PASS_COMPLETE, g_ulReplayDatasetCount,
+              now - ulReplayPassStartTick);
+    ulReplayPassStartTick = now;
+  }
+
+  return HAL_OK;
+}
+
+#endif /* REPLAY_BUILD */
@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file           : replay.h
+ * @brief          : Sensor stream capture and replay harness header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Deterministic bench replay of recorded IMU data
+ *                  - Capture mode (SENSOR_CAPTURE_STREAM=1 in a normal
+ *                    build): every committed raw sample is packed into two
+ *                    records on the binary log stream; the host splits the
+ *                    capture back out with tools/replay_capture.py
+ *                  - Replay build (python build.py replay, REPLAY_BUILD
+ *                    macro): SensorAcq_ReadIMU is fed from a recorded
+ *                    dataset linked into flash instead of the LSM6DSL, one
+ *                    sample per tick - the full acquisition-fusion-control
+ *                    pipeline runs an order of magnitude faster than
+ *                    wall-clock sensor time, with sample timestamps kept
+ *                    in the recorded timeline so fusion integrates the
+ *                    same dt as in the field
+ *                  - tools/replay_capture.py --emit-c turns a capture into
+ *                    firmware/src/replay_data.c, which overrides the weak
+ *                    built-in dataset
+ ******************************************************************************
+ */
+
+#ifndef __REPLAY_H
+#define __REPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "lsm6dsl.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* One recorded IMU frame; timestamps are reconstructed on replay from the
+ * frame index at SENSOR_SAMPLE_PERIOD_MS spacing */
+typedef struct {
+  int16_t accel[3];             // Raw accelerometer counts
+  int16_t gyro[3];              // Raw gyroscope counts
+} ReplayFrame_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Set to 1 to stream every committed raw sample onto the binary log
+ * channel for later replay (costs two Log_Write calls per sample) */
+#ifndef SENSOR_CAPTURE_STREAM
+#define SENSOR_CAPTURE_STREAM       0
+#endif
+
+/* Replay datasets are recorded at the 2g / 250dps default full scale */
+#define REPLAY_ACCEL_SENSITIVITY    0.061f   // mg/LSB
+#define REPLAY_GYRO_SENSITIVITY     8.75f    // mdps/LSB
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Pack one committed raw sample onto the binary log stream
+ * @param  sample: committed sensor sample
+ * @retval None
+ */
+void Replay_CaptureSample(const SensorData_t *sample);
+
+#ifdef REPLAY_BUILD
+
+/* Recorded dataset - the weak built-in table in replay.c is overridden by
+ * linking a generated firmware/src/replay_data.c */
+extern const ReplayFrame_t g_xReplayDataset[];
+extern const uint32_t g_ulReplayDatasetCount;
+
+/**
+ * @brief  Reset the replay cursor and pass statistics
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Replay_Init(void);
+
+/**
+ * @brief  Get the raw-to-physical scale factors of the recorded data
+ * @param  accel_lsb: accelerometer m/s^2 per LSB
+ * @param  gyro_lsb: gyroscope rad/s per LSB
+ * @retval None
+ */
+void Replay_GetScale(float *accel_lsb, float *gyro_lsb);
+
+/**
+ * @brief  Produce the next recorded sample (wraps around at dataset end
+ *         and emits a pass-complete log record)
+ * @param  sample: filled with the recorded frame and a synthetic
+ *         recorded-timeline timestamp
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Replay_ReadSample(LSM6DSL_RawSample_t *sample);
+
+#endif /* REPLAY_BUILD */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __REPLAY_H */
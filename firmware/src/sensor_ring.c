@@ -0,0 +1,101 @@
+/**
+ ******************************************************************************
+ * @file           : sensor_ring.c
+ * @brief          : Zero-copy sensor sample ring buffer implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Removes the per-sample memcpy traffic through the FreeRTOS
+ *                   queues: SensorAcqTask writes each SensorData_t directly
+ *                   into a static slot and only a 16-bit slot index travels
+ *                   through the queue. Downstream tasks read the slot in place.
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor_ring.h"
+#include "sram2.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SENSOR_RING_MASK            (SENSOR_RING_SLOTS - 1)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Static sample pool - single producer (SensorAcqTask), in-place consumers.
+ * Pinned into SRAM2 for zero-wait-state access and parity protection: every
+ * task in the pipeline touches these slots each cycle. */
+SRAM2_BSS static SensorData_t xSampleSlots[SENSOR_RING_SLOTS];
+
+/* Next slot the producer will claim; only the producer writes this */
+static volatile uint16_t usWriteIndex = 0;
+
+/* Shared IMU scale table referenced by the scale_id in each sample; written
+ * by the acquisition side at init and on full-scale changes, read by the
+ * lazy-conversion accessors in main.h */
+SensorScale_t xSensorScales[SENSOR_SCALE_SLOTS] = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Reset the ring to empty (producer side, before acquisition starts)
+ * @retval None
+ */
+void SensorRing_Reset(void)
+{
+  memset(xSampleSlots, 0, sizeof(xSampleSlots));
+  usWriteIndex = 0;
+}
+
+/**
+ * @brief  Claim the next free slot for in-place writing (producer only)
+ * @retval Pointer to the claimed SensorData_t slot
+ */
+SensorData_t *SensorRing_Claim(void)
+{
+  return &xSampleSlots[usWriteIndex & SENSOR_RING_MASK];
+}
+
+/**
+ * @brief  Publish the currently claimed slot (producer only)
+ * @retval Index of the committed slot, to hand to consumers
+ */
+SensorRingIndex_t SensorRing_Commit(void)
+{
+  SensorRingIndex_t index = (SensorRingIndex_t)(usWriteIndex & SENSOR_RING_MASK);
+
+  usWriteIndex++;
+  return index;
+}
+
+/**
+ * @brief  Get a read-only view of a committed slot (consumer side)
+ * @param  index: slot index received from the producer
+ * @retval Pointer to the sample, or NULL if the index is out of range
+ */
+const SensorData_t *SensorRing_Get(SensorRingIndex_t index)
+{
+  if (index >= SENSOR_RING_SLOTS) {
+    return NULL;
+  }
+  return &xSampleSlots[index];
+}
+
+/**
+ * @brief  Publish the scale factors for one scale table slot
+ * @param  scale_id: table slot (< SENSOR_SCALE_SLOTS)
+ * @param  accel_lsb: m/s² per accelerometer count
+ * @param  gyro_lsb: rad/s per gyroscope count
+ * @retval None
+ */
+void SensorScale_Set(uint8_t scale_id, float accel_lsb, float gyro_lsb)
+{
+  if (scale_id < SENSOR_SCALE_SLOTS) {
+    xSensorScales[scale_id].accel_lsb = accel_lsb;
+    xSensorScales[scale_id].gyro_lsb = gyro_lsb;
+  }
+}
@@ -0,0 +1,83 @@
+/**
+ ******************************************************************************
+ * @file           : sensor_ring.h
+ * @brief          : Zero-copy sensor sample ring buffer header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Statically allocated single-producer ring of SensorData_t
+ *                   slots. The producer writes samples in place and hands
+ *                   consumers a slot index through the existing queues, so no
+ *                   SensorData_t struct is ever copied between tasks.
+ *                  - Producer: SensorRing_Claim() -> fill slot -> SensorRing_Commit()
+ *                  - Consumer: SensorRing_Get(index) -> read in place
+ *                  - A slot stays valid for SENSOR_RING_SLOTS further samples
+ *                    before the producer wraps around and reuses it
+ ******************************************************************************
+ */
+
+#ifndef __SENSOR_RING_H
+#define __SENSOR_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Slot index passed between producer and consumers instead of struct copies */
+typedef uint16_t SensorRingIndex_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Number of sample slots (power of two). At 400Hz a slot lives 40ms before
+ * reuse, well beyond the fusion/control consumption deadline. */
+#define SENSOR_RING_SLOTS           16
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Reset the ring to empty (producer side, before acquisition starts)
+ * @retval None
+ */
+void SensorRing_Reset(void);
+
+/**
+ * @brief  Claim the next free slot for in-place writing (producer only)
+ * @retval Pointer to the claimed SensorData_t slot
+ */
+SensorData_t *SensorRing_Claim(void);
+
+/**
+ * @brief  Publish the currently claimed slot (producer only)
+ * @retval Index of the committed slot, to hand to consumers
+ */
+SensorRingIndex_t SensorRing_Commit(void);
+
+/**
+ * @brief  Get a read-only view of a committed slot (consumer side)
+ * @param  index: slot index received from the producer
+ * @retval Pointer to the sample, or NULL if the index is out of range
+ */
+const SensorData_t *SensorRing_Get(SensorRingIndex_t index);
+
+/**
+ * @brief  Publish the scale factors for one scale table slot
+ * @param  scale_id: table slot (< SENSOR_SCALE_SLOTS)
+ * @param  accel_lsb: m/s² per accelerometer count
+ * @param  gyro_lsb: rad/s per gyroscope count
+ * @retval None
+ */
+void SensorScale_Set(uint8_t scale_id, float accel_lsb, float gyro_lsb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SENSOR_RING_H */
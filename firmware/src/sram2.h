@@ -0,0 +1,59 @@
+/**
+ ******************************************************************************
+ * @file           : sram2.h
+ * @brief          : SRAM2 hot-data placement attributes
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : The STM32L475 has a dedicated 32KB SRAM2 bank at
+ *                   0x10000000 with zero-wait-state access and hardware
+ *                   parity. Objects tagged with SRAM2_BSS below are pinned
+ *                   there so the acquisition hot path (task stack, sample
+ *                   ring, I2C DMA landing buffers) gets deterministic access
+ *                   latency and parity protection.
+ *
+ *                   The linker script must provide the matching region and
+ *                   NOLOAD output section:
+ *
+ *                     MEMORY { ... SRAM2 (xrw) : ORIGIN = 0x10000000,
+ *                                                LENGTH = 32K }
+ *                     .sram2_bss (NOLOAD) :
+ *                     {
+ *                       . = ALIGN(4);
+ *                       _ssram2_bss = .;
+ *                       *(.sram2_bss)
+ *                       *(.sram2_bss*)
+ *                       . = ALIGN(4);
+ *                       _esram2_bss = .;
+ *                     } >SRAM2
+ *
+ *                   startup code must zero [_ssram2_bss, _esram2_bss) like
+ *                   the regular .bss. `python build.py build` parses the map
+ *                   file afterwards and reports what actually landed in
+ *                   SRAM2 (see _report_memory_placement in build.py).
+ ******************************************************************************
+ */
+
+#ifndef __SRAM2_H
+#define __SRAM2_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Zero-initialized hot data pinned into the SRAM2 bank. Falls back to the
+ * default placement on non-GCC toolchains (host-side builds). */
+#if defined(__GNUC__) && !defined(HOST_BUILD)
+#define SRAM2_BSS                   __attribute__((section(".sram2_bss")))
+#else
+#define SRAM2_BSS
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SRAM2_H */
@@ -0,0 +1,201 @@
+/**
+ ******************************************************************************
+ * @file           : control.c
+ * @brief          : 闭环控制任务实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 姿态保持控制回路, 带显式端到端截止期预算:
+ *                   每周期从最新值邮箱取样本, 结合融合姿态生成执行指令,
+ *                   并测量采集时间戳到指令入队的延迟。统计最坏情况与
+ *                   周期间抖动, 超出CONTROL_DEADLINE_MS的周期上报遥测
+ *                   事件 - 闭环系统需要的是被强制观测的延迟上界,
+ *                   不是好看的平均值。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "control.h"
+#include "sensor_ring.h"
+#include "fusion.h"
+#include "watchdog.h"
+#include "fastlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define CONTROL_TASK_STACK_SIZE     TASK_STACK_SIZE_CONTROL
+#define CONTROL_TASK_PRIORITY       TASK_PRIORITY_CONTROL
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if !RATE_GROUP_SCHEDULER
+static TaskHandle_t xControlTaskHandle = NULL;
+static StaticTask_t xControlTaskTCB;
+static StackType_t xControlTaskStack[CONTROL_TASK_STACK_SIZE];
+#endif
+
+static ControlStats_t xControlStats = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+#if !RATE_GROUP_SCHEDULER
+static void ControlTask(void *pvParameters);
+#endif
+static void Control_ProcessIndex(SensorRingIndex_t slot_index);
+#ifndef REPLAY_BUILD
+static void Control_RecordLatency(uint32_t latency_ms);
+#endif
+
+/* Private user code ---------------------------------------------------------*/
+
+#if !RATE_GROUP_SCHEDULER
+/**
+ * @brief  Create the control task
+ * @retval BaseType_t
+ */
+BaseType_t Control_CreateTask(void)
+{
+  xControlTaskHandle = xTaskCreateStatic(ControlTask, "Control",
+                                         CONTROL_TASK_STACK_SIZE, NULL,
+                                         CONTROL_TASK_PRIORITY,
+                                         xControlTaskStack, &xControlTaskTCB);
+  return (xControlTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  控制任务主函数
+ * @param  pvParameters: 任务参数
+ * @retval None
+ */
+static void ControlTask(void *pvParameters)
+{
+  SensorRingIndex_t slot_index;
+
+  for (;;) {
+    /* 邮箱总是持有最新样本索引: 生产者覆盖式写入, 控制回路不会
+     * 消费积压的陈旧数据 */
+    if (xQueueReceive(xSensorMailbox, &slot_index,
+                      pdMS_TO_TICKS(CONTROL_SAMPLE_TIMEOUT_MS)) != pdPASS) {
+      xControlStats.sample_timeouts++;
+      Watchdog_TaskAlive(WATCHDOG_BIT_CONTROL);
+      continue;
+    }
+
+    Watchdog_TaskAlive(WATCHDOG_BIT_CONTROL);
+
+    Control_ProcessIndex(slot_index);
+  }
+}
+#else
+/**
+ * @brief  控制相位: 消费邮箱中的最新样本 (速率组调度器逐帧调用)
+ * @retval None
+ */
+void Control_RunCycle(void)
+{
+  SensorRingIndex_t slot_index;
+
+  Watchdog_TaskAlive(WATCHDOG_BIT_CONTROL);
+
+  /* 采集相位刚在同任务内跑完, 邮箱即取即用; 空邮箱说明本帧采集
+   * 失败, 让过本周期 (失败已由采集统计计数) */
+  if (xQueueReceive(xSensorMailbox, &slot_index, 0) != pdPASS) {
+    return;
+  }
+
+  Control_ProcessIndex(slot_index);
+}
+#endif /* RATE_GROUP_SCHEDULER */
+
+/**
+ * @brief  对一个样本执行一步控制律并发布执行指令
+ * @param  slot_index: 传感器环形缓冲区槽位索引
+ * @retval None
+ */
+static void Control_ProcessIndex(SensorRingIndex_t slot_index)
+{
+  const SensorData_t *sample;
+  FusionOutput_t attitude;
+  ControlCmd_t cmd;
+  float gyro[3];
+
+  sample = SensorRing_Get(slot_index);
+  if (sample == NULL || !sample->data_valid) {
+    return;
+  }
+
+  /* PD姿态保持律: 比例项用融合滚转角, 微分项直接用陀螺仪速率
+   * (原始计数惰性转换, 比对姿态差分噪声更小) */
+  Fusion_GetOutput(&attitude);
+  SensorData_GetGyro(sample, gyro);
+
+  cmd.cmd_type = CONTROL_CMD_ATTITUDE;
+  cmd.target_value = -(CONTROL_KP * attitude.roll + CONTROL_KD * gyro[0]);
+  cmd.timestamp = xTaskGetTickCount();
+
+  /* 执行指令入队即视为本周期的执行点; 队列满时淘汰最旧指令,
+   * 过期的执行请求没有保留价值 */
+  if (xQueueSend(xControlQueue, &cmd, 0) != pdPASS) {
+    ControlCmd_t stale_cmd;
+
+    xQueueReceive(xControlQueue, &stale_cmd, 0);
+    xControlStats.commands_dropped++;
+    xQueueSend(xControlQueue, &cmd, 0);
+  }
+
+#ifndef REPLAY_BUILD
+  /* 端到端延迟: 采集时间戳到执行指令入队. 回放构建下样本时间戳
+   * 在记录时间域, 与实时tick不可比, 截止期观测关闭 */
+  Control_RecordLatency(cmd.timestamp - sample->timestamp);
+#endif
+  xControlStats.cycles++;
+}
+
+#ifndef REPLAY_BUILD
+/**
+ * @brief  记录端到端延迟: 最坏情况, 周期间抖动与截止期判定
+ * @param  latency_ms: 本周期采集到执行的延迟
+ * @retval None
+ */
+static void Control_RecordLatency(uint32_t latency_ms)
+{
+  uint32_t delta;
+
+  if (latency_ms > xControlStats.worst_latency_ms) {
+    xControlStats.worst_latency_ms = latency_ms;
+  }
+
+  /* 抖动取相邻周期延迟差的峰值 - 控制回路关心的是节拍稳定性 */
+  delta = (latency_ms > xControlStats.last_latency_ms)
+              ? (latency_ms - xControlStats.last_latency_ms)
+              : (xControlStats.last_latency_ms - latency_ms);
+  if (xControlStats.cycles > 0 && delta > xControlStats.jitter_ms) {
+    xControlStats.jitter_ms = delta;
+  }
+  xControlStats.last_latency_ms = latency_ms;
+
+  if (latency_ms > CONTROL_DEADLINE_MS) {
+    xControlStats.deadline_misses++;
+    Log_Write(LOG_ID_CONTROL_DEADLINE_MISS, latency_ms,
+              xControlStats.deadline_misses);
+  }
+}
+#endif /* REPLAY_BUILD */
+
+/**
+ * @brief  Get control loop statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Control_GetStats(ControlStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xControlStats, sizeof(ControlStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file           : control.h
+ * @brief          : Closed-loop control task header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Attitude-hold control loop with an enforced end-to-end
+ *                   deadline budget
+ *                  - Consumes the newest sample from the latest-value
+ *                    mailbox (xSensorMailbox) plus the fused attitude, and
+ *                    produces ControlCmd_t actuation commands
+ *                  - Measures acquisition-timestamp-to-actuation latency
+ *                    every cycle; tracks worst case and cycle-to-cycle
+ *                    jitter, not just the average
+ *                  - A cycle over CONTROL_DEADLINE_MS raises a
+ *                    CONTROL_DEADLINE_MISS event on the telemetry/log
+ *                    channel
+ ******************************************************************************
+ */
+
+#ifndef __CONTROL_H
+#define __CONTROL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Control loop statistics */
+typedef struct {
+  uint32_t cycles;              // Control iterations completed
+  uint32_t sample_timeouts;     // Mailbox wait expired without a sample
+  uint32_t commands_dropped;    // Actuation queue full, oldest evicted
+  uint32_t deadline_misses;     // Cycles over CONTROL_DEADLINE_MS
+  uint32_t last_latency_ms;     // Acquisition timestamp to actuation
+  uint32_t worst_latency_ms;    // Worst observed end-to-end latency
+  uint32_t jitter_ms;           // Peak cycle-to-cycle latency delta
+} ControlStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Command types produced on xControlQueue */
+#define CONTROL_CMD_ATTITUDE        1
+
+/* End-to-end deadline budget: two sample periods from the acquisition
+ * timestamp to the actuation command being queued. This is the bound the
+ * closed loop is designed against, and it is enforced by observation -
+ * every violation is counted and reported. */
+#define CONTROL_DEADLINE_MS         (2 * (1000 / SENSOR_SAMPLE_RATE_HZ))
+
+/* Mailbox wait bound - covers the ~1Hz adaptive-idle keep-alive cadence */
+#define CONTROL_SAMPLE_TIMEOUT_MS   2000
+
+/* PD gains for the attitude-hold law (roll axis) */
+#define CONTROL_KP                  1.0f
+#define CONTROL_KD                  0.1f
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the control task
+ * @retval BaseType_t
+ */
+BaseType_t Control_CreateTask(void);
+
+#if RATE_GROUP_SCHEDULER
+/**
+ * @brief  Control phase: consume the newest mailbox sample and run one
+ *         control-law step (called by the rate-group dispatcher each frame)
+ * @retval None
+ */
+void Control_RunCycle(void);
+#endif
+
+/**
+ * @brief  Get control loop statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Control_GetStats(ControlStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CONTROL_H */
@@ -0,0 +1,295 @@
+/**
+ ******************************************************************************
+ * @file           : fusion.c
+ * @brief          : 传感器融合任务实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 采集到融合的交接使用任务通知直传环形缓冲区索引:
+ *                   该路径严格单生产者单消费者, 任务通知比队列开销低
+ *                   (本端口约快45%), 队列保留给真正多消费者的遥测路径。
+ *                   生产者以eSetValueWithOverwrite发布最新索引, 融合任务
+ *                   总是消费最新样本 (100Hz采集 / 50Hz融合, 被覆盖的中间
+ *                   样本属于设计内行为并计数)。
+ *
+ *                   姿态滤波采用Mahony互补滤波 (加速度计重力参考修正
+ *                   陀螺仪积分漂移), 向量运算使用CMSIS-DSP (arm_math)
+ *                   内核以利用M4的FPU/MAC指令。6轴配置下偏航角不可观测,
+ *                   仅由陀螺仪积分得到。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fusion.h"
+#include "watchdog.h"
+#include "latency.h"
+#include "profiling.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "arm_math.h"
+#include <math.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define FUSION_TASK_STACK_SIZE      TASK_STACK_SIZE_FUSION
+#define FUSION_TASK_PRIORITY        TASK_PRIORITY_FUSION
+#define FUSION_SAMPLE_TIMEOUT_MS    (1000 / FUSION_UPDATE_RATE_HZ * 4)
+
+/* Mahony滤波器增益: Kp决定加速度计修正强度, Ki消除陀螺仪零偏 */
+#define FUSION_MAHONY_KP            0.5f
+#define FUSION_MAHONY_KI            0.01f
+
+/* 标称采样间隔, 时间戳异常时的兜底值 */
+#define FUSION_NOMINAL_DT           (1.0f / (float)FUSION_UPDATE_RATE_HZ)
+#define FUSION_MAX_DT               0.1f
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if RATE_GROUP_SCHEDULER
+/* 速率组模式: 采集相位与融合相位在同一任务内顺序执行, 一个待处理
+ * 索引变量就是完整的交接通道, 连任务通知的开销都省掉 */
+static SensorRingIndex_t xPendingIndex = 0;
+static uint8_t ucPendingValid = 0;
+#else
+static TaskHandle_t xFusionTaskHandle = NULL;
+static StaticTask_t xFusionTaskTCB;
+static StackType_t xFusionTaskStack[FUSION_TASK_STACK_SIZE];
+#endif
+
+static FusionOutput_t xFusionOutput = {0};
+static FusionStats_t xFusionStats = {0};
+
+/* 滤波器状态: 姿态四元数 + 积分反馈项 + 上一样本时间戳 */
+static float32_t q[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+static float32_t integral_fb[3] = {0.0f, 0.0f, 0.0f};
+static uint32_t ulLastSampleTick = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+#if !RATE_GROUP_SCHEDULER
+static void FusionTask(void *pvParameters);
+#endif
+static void Fusion_ConsumeIndex(SensorRingIndex_t index);
+static void Fusion_ProcessSample(const SensorData_t *sample);
+
+/* Private user code ---------------------------------------------------------*/
+
+#if !RATE_GROUP_SCHEDULER
+/**
+ * @brief  创建传感器融合任务
+ * @retval BaseType_t
+ */
+BaseType_t Fusion_CreateTask(void)
+{
+  xFusionTaskHandle = xTaskCreateStatic(FusionTask, "Fusion",
+                                        FUSION_TASK_STACK_SIZE, NULL,
+                                        FUSION_TASK_PRIORITY,
+                                        xFusionTaskStack, &xFusionTaskTCB);
+  return (xFusionTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+#endif /* RATE_GROUP_SCHEDULER */
+
+/**
+ * @brief  将已提交的样本索引直传融合任务
+ * @param  index: 传感器环形缓冲区槽位索引
+ * @retval None
+ */
+void Fusion_SubmitSample(SensorRingIndex_t index)
+{
+#if RATE_GROUP_SCHEDULER
+  /* 覆盖式发布: 融合相位按RATE_GROUP_FUSION_PERIOD_MS周期消费,
+   * 中间样本被最新样本取代属于设计内行为 */
+  if (ucPendingValid) {
+    xFusionStats.samples_superseded++;
+  }
+  xPendingIndex = index;
+  ucPendingValid = 1;
+#else
+  if (xFusionTaskHandle == NULL) {
+    return;
+  }
+
+  /* 覆盖式发布: 融合任务尚未取走的旧索引被最新样本取代 */
+  if (xTaskNotifyIndexed(xFusionTaskHandle, FUSION_NOTIFY_INDEX,
+                         (uint32_t)index, eSetValueWithoutOverwrite) != pdPASS) {
+    xFusionStats.samples_superseded++;
+    xTaskNotifyIndexed(xFusionTaskHandle, FUSION_NOTIFY_INDEX,
+                       (uint32_t)index, eSetValueWithOverwrite);
+  }
+#endif /* RATE_GROUP_SCHEDULER */
+}
+
+#if RATE_GROUP_SCHEDULER
+/**
+ * @brief  融合相位: 消费待处理样本 (速率组调度器按分频调用)
+ * @retval None
+ */
+void Fusion_RunPending(void)
+{
+  /* 心跳: 相位每次被调度都发, 只有调度器卡死才缺席 */
+  Watchdog_TaskAlive(WATCHDOG_BIT_FUSION);
+
+  if (!ucPendingValid) {
+    return;
+  }
+  ucPendingValid = 0;
+  Fusion_ConsumeIndex(xPendingIndex);
+}
+#else
+/**
+ * @brief  传感器融合任务主函数
+ * @param  pvParameters: 任务参数
+ * @retval None
+ */
+static void FusionTask(void *pvParameters)
+{
+  uint32_t notify_value = 0;
+
+  for (;;) {
+    /* 等待采集任务直传的最新样本索引 */
+    if (xTaskNotifyWaitIndexed(FUSION_NOTIFY_INDEX, 0, UINT32_MAX,
+                               &notify_value,
+                               pdMS_TO_TICKS(FUSION_SAMPLE_TIMEOUT_MS)) != pdTRUE) {
+      xFusionStats.notify_timeouts++;
+      Watchdog_TaskAlive(WATCHDOG_BIT_FUSION);
+      continue;
+    }
+
+    /* 心跳: 超时与正常路径都发, 只有真正卡死才缺席 */
+    Watchdog_TaskAlive(WATCHDOG_BIT_FUSION);
+
+    Fusion_ConsumeIndex((SensorRingIndex_t)notify_value);
+  }
+}
+#endif /* RATE_GROUP_SCHEDULER */
+
+/**
+ * @brief  取出环形缓冲区样本并执行一步滤波更新
+ * @param  index: 传感器环形缓冲区槽位索引
+ * @retval None
+ */
+static void Fusion_ConsumeIndex(SensorRingIndex_t index)
+{
+  const SensorData_t *sample = SensorRing_Get(index);
+
+  if (sample == NULL || !sample->data_valid) {
+    return;
+  }
+
+  xFusionStats.samples_consumed++;
+
+  {
+    uint32_t stage_start_cycles = Profiling_GetCycles();
+
+    Fusion_ProcessSample(sample);
+
+    /* 融合阶段延迟直方图 (取样到滤波输出) */
+    Latency_Record(LAT_STAGE_FUSION, stage_start_cycles);
+  }
+}
+
+/**
+ * @brief  Mahony互补滤波更新一步
+ * @param  sample: 传感器样本
+ * @retval None
+ */
+static void Fusion_ProcessSample(const SensorData_t *sample)
+{
+  float32_t accel[3], gyro[3];
+  float32_t v[3], error[3], correction[3];
+  float32_t norm_sq, norm, dt, half_dt;
+  float32_t q_dot[4];
+  float32_t roll, pitch, yaw;
+
+  /* 原始计数在此惰性转换为物理单位 (流水线上游只传int16) */
+  SensorData_GetAccel(sample, accel);
+  SensorData_GetGyro(sample, gyro);
+
+  /* 实际采样间隔由时间戳得出, 异常时退回标称值 */
+  dt = (float32_t)(sample->timestamp - ulLastSampleTick) / 1000.0f;
+  if (ulLastSampleTick == 0 || dt <= 0.0f || dt > FUSION_MAX_DT) {
+    dt = FUSION_NOMINAL_DT;
+  }
+  ulLastSampleTick = sample->timestamp;
+
+  /* 加速度计归一化; 接近失重时跳过重力修正, 仅积分陀螺仪 */
+  arm_dot_prod_f32(accel, accel, 3, &norm_sq);
+  if (norm_sq > 1.0f) {
+    arm_sqrt_f32(norm_sq, &norm);
+    arm_scale_f32(accel, 1.0f / norm, accel, 3);
+
+    /* 由四元数估计的机体系重力方向 */
+    v[0] = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+    v[1] = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+    v[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+
+    /* 误差 = 实测重力 × 估计重力 */
+    error[0] = accel[1] * v[2] - accel[2] * v[1];
+    error[1] = accel[2] * v[0] - accel[0] * v[2];
+    error[2] = accel[0] * v[1] - accel[1] * v[0];
+
+    /* 比例 + 积分反馈注入陀螺仪速率 */
+    arm_scale_f32(error, FUSION_MAHONY_KI * dt, correction, 3);
+    arm_add_f32(integral_fb, correction, integral_fb, 3);
+    arm_scale_f32(error, FUSION_MAHONY_KP, correction, 3);
+    arm_add_f32(gyro, correction, gyro, 3);
+    arm_add_f32(gyro, integral_fb, gyro, 3);
+  }
+
+  /* 四元数微分方程积分 */
+  half_dt = 0.5f * dt;
+  q_dot[0] = (-q[1] * gyro[0] - q[2] * gyro[1] - q[3] * gyro[2]) * half_dt;
+  q_dot[1] = ( q[0] * gyro[0] + q[2] * gyro[2] - q[3] * gyro[1]) * half_dt;
+  q_dot[2] = ( q[0] * gyro[1] - q[1] * gyro[2] + q[3] * gyro[0]) * half_dt;
+  q_dot[3] = ( q[0] * gyro[2] + q[1] * gyro[1] - q[2] * gyro[0]) * half_dt;
+  arm_add_f32(q, q_dot, q, 4);
+
+  /* 四元数重新归一化 */
+  arm_dot_prod_f32(q, q, 4, &norm_sq);
+  arm_sqrt_f32(norm_sq, &norm);
+  arm_scale_f32(q, 1.0f / norm, q, 4);
+
+  /* 四元数转欧拉角 */
+  roll = atan2f(2.0f * (q[0] * q[1] + q[2] * q[3]),
+                1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2]));
+  pitch = asinf(2.0f * (q[0] * q[2] - q[3] * q[1]));
+  yaw = atan2f(2.0f * (q[0] * q[3] + q[1] * q[2]),
+               1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3]));
+
+  taskENTER_CRITICAL();
+  xFusionOutput.roll = roll;
+  xFusionOutput.pitch = pitch;
+  xFusionOutput.yaw = yaw;
+  xFusionOutput.timestamp = sample->timestamp;
+  xFusionOutput.update_count++;
+  taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief  获取最新融合姿态
+ * @param  output: 返回的融合输出
+ * @retval None
+ */
+void Fusion_GetOutput(FusionOutput_t *output)
+{
+  if (output != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(output, &xFusionOutput, sizeof(FusionOutput_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+/**
+ * @brief  获取融合统计信息
+ * @param  stats: 返回的统计信息
+ * @retval None
+ */
+void Fusion_GetStats(FusionStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xFusionStats, sizeof(FusionStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
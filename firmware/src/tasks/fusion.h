@@ -0,0 +1,97 @@
+/**
+ ******************************************************************************
+ * @file           : fusion.h
+ * @brief          : Sensor fusion task header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : On-device sensor fusion over the SensorData_t stream
+ *                  - Fed directly from SensorAcqTask via a task notification
+ *                    carrying the sample ring index (no queue on this
+ *                    single-producer single-consumer path)
+ *                  - Runs at FUSION_UPDATE_RATE_HZ, consuming the newest
+ *                    sample; intermediate samples are superseded by design
+ ******************************************************************************
+ */
+
+#ifndef __FUSION_H
+#define __FUSION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sensor_ring.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Fused attitude output */
+typedef struct {
+  float roll;               // Roll angle (rad)
+  float pitch;              // Pitch angle (rad)
+  float yaw;                // Yaw angle (rad)
+  uint32_t timestamp;       // Source sample timestamp
+  uint32_t update_count;    // Filter iterations since boot
+} FusionOutput_t;
+
+/* Fusion statistics */
+typedef struct {
+  uint32_t samples_consumed;    // Notifications received
+  uint32_t samples_superseded;  // Producer overwrote a pending index
+  uint32_t notify_timeouts;     // Wait expired without a fresh sample
+} FusionStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Task notification index used for the acquisition handoff (index 1 is
+ * the I2C engine, index 2 the log UART) */
+#define FUSION_NOTIFY_INDEX         0
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the sensor fusion task
+ * @retval BaseType_t
+ */
+BaseType_t Fusion_CreateTask(void);
+
+/**
+ * @brief  Hand a committed sample ring index to the fusion task
+ * @param  index: sensor ring slot index
+ * @retval None
+ */
+void Fusion_SubmitSample(SensorRingIndex_t index);
+
+#if RATE_GROUP_SCHEDULER
+/**
+ * @brief  Fusion phase: consume the pending sample, if any (called by the
+ *         rate-group dispatcher at the fusion subrate)
+ * @retval None
+ */
+void Fusion_RunPending(void);
+#endif
+
+/**
+ * @brief  Get the latest fused attitude
+ * @param  output: returned fusion output
+ * @retval None
+ */
+void Fusion_GetOutput(FusionOutput_t *output);
+
+/**
+ * @brief  Get fusion statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Fusion_GetStats(FusionStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FUSION_H */
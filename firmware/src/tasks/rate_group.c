@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @file           : rate_group.c
+ * @brief          : 速率组执行器实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 流水线各速率 (100/50/10Hz) 互为整数倍, 独立周期任务
+ *                   付出的上下文切换与独立栈是纯开销。本执行器以传感器
+ *                   数据就绪事件为帧节拍, 在单任务单栈上按固定相位序
+ *                   依次执行: 采集(每帧) -> 融合(每20ms) -> 控制(每帧)
+ *                   -> 遥测(每100ms)。融合先于控制, 控制律总是拿到本帧
+ *                   姿态; 相位间交接退化为同任务内的函数调用, 采集与
+ *                   融合零调度延迟对齐。阻塞I/O的任务 (I2C引擎/日志/
+ *                   MQTT/看门狗) 保持独立。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rate_group.h"
+#include "sensor_acq.h"
+#include "fusion.h"
+#include "control.h"
+#include "telemetry.h"
+#include "sram2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+#if RATE_GROUP_SCHEDULER
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define RATE_GROUP_TASK_STACK_SIZE  TASK_STACK_SIZE_RATE_GROUP
+#define RATE_GROUP_TASK_PRIORITY    TASK_PRIORITY_RATE_GROUP
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static TaskHandle_t xRateGroupTaskHandle = NULL;
+static StaticTask_t xRateGroupTaskTCB;
+/* 调度器栈承载整条流水线的热路径, 与原采集任务栈一样钉在SRAM2 */
+SRAM2_BSS static StackType_t xRateGroupTaskStack[RATE_GROUP_TASK_STACK_SIZE];
+
+static RateGroupStats_t xRateGroupStats = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+static void RateGroupTask(void *pvParameters);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  创建速率组调度器任务
+ * @retval BaseType_t
+ */
+BaseType_t RateGroup_CreateTask(void)
+{
+  xRateGroupTaskHandle = xTaskCreateStatic(RateGroupTask, "RateGroup",
+                                           RATE_GROUP_TASK_STACK_SIZE, NULL,
+                                           RATE_GROUP_TASK_PRIORITY,
+                                           xRateGroupTaskStack,
+                                           &xRateGroupTaskTCB);
+  return (xRateGroupTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  速率组调度器主函数
+ * @param  pvParameters: 任务参数
+ * @retval None
+ */
+static void RateGroupTask(void *pvParameters)
+{
+  TickType_t frame_start;
+  TickType_t last_fusion;
+  TickType_t last_telemetry;
+
+  /* 采集环境在调度器上下文建立: INT1通知路由到本任务, 驱动初始化
+   * 的复位等待期间其余任务照常并行启动 */
+  SensorAcq_TaskSetup();
+  Telemetry_Setup();
+
+  /* 初值各回拨一个周期, 首帧即执行全部相位 */
+  frame_start = xTaskGetTickCount();
+  last_fusion = frame_start - pdMS_TO_TICKS(RATE_GROUP_FUSION_PERIOD_MS);
+  last_telemetry = frame_start - pdMS_TO_TICKS(RATE_GROUP_TELEMETRY_PERIOD_MS);
+
+  for (;;) {
+    /* 帧节拍由数据就绪事件驱动 (INT1/空闲保活/回放节拍), 不用
+     * vTaskDelayUntil对齐 - 相位起点就是样本到达时刻 */
+    SensorAcq_WaitFrame();
+    frame_start = xTaskGetTickCount();
+
+    /* 固定相位序: 采集 -> 融合 -> 控制 -> 遥测。子速率按流逝时间
+     * 而非帧计数触发: 自适应空闲把帧节拍拉长到SENSOR_IDLE_PERIOD_MS,
+     * 按帧分频会让遥测相位10秒才跑一次, 饿死其看门狗心跳并触发
+     * 误复位; 按时间判定在满速率下等价于每2/10帧, 空闲时退化为
+     * 每个保活帧都执行 */
+    SensorAcq_RunFrame();
+
+    if ((TickType_t)(frame_start - last_fusion) >=
+        pdMS_TO_TICKS(RATE_GROUP_FUSION_PERIOD_MS)) {
+      Fusion_RunPending();
+      last_fusion = frame_start;
+      xRateGroupStats.fusion_runs++;
+    }
+
+    Control_RunCycle();
+
+    if ((TickType_t)(frame_start - last_telemetry) >=
+        pdMS_TO_TICKS(RATE_GROUP_TELEMETRY_PERIOD_MS)) {
+      Telemetry_RunCycle();
+      last_telemetry = frame_start;
+      xRateGroupStats.telemetry_runs++;
+    }
+
+    /* 相位链吃满一个采样周期即记超帧 - 预算耗尽的早期信号 */
+    if ((xTaskGetTickCount() - frame_start) > pdMS_TO_TICKS(SENSOR_SAMPLE_PERIOD_MS)) {
+      xRateGroupStats.frame_overruns++;
+    }
+
+    xRateGroupStats.frames++;
+  }
+}
+
+/**
+ * @brief  获取速率组统计信息
+ * @param  stats: 返回的统计信息
+ * @retval None
+ */
+void RateGroup_GetStats(RateGroupStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xRateGroupStats, sizeof(RateGroupStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+#endif /* RATE_GROUP_SCHEDULER */
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file           : rate_group.h
+ * @brief          : Rate-group executive header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Hierarchical rate-group dispatcher for the sensor
+ *                   pipeline (active when RATE_GROUP_SCHEDULER is set)
+ *                  - The pipeline rates are exact harmonics of the 100Hz
+ *                    sample rate, so acquisition, fusion, control and
+ *                    telemetry run as phases of one dispatcher task in a
+ *                    fixed order on a single stack
+ *                  - Frame start is the sensor data-ready event itself;
+ *                    acquisition and control run every frame, fusion and
+ *                    telemetry at their own rates by elapsed time (every
+ *                    2nd/10th frame at full rate, every keep-alive frame
+ *                    when adaptive idle stretches the cadence)
+ *                  - Tasks that block on I/O (I2C bus engine, log drain,
+ *                    MQTT connection, watchdog) stay independent
+ ******************************************************************************
+ */
+
+#ifndef __RATE_GROUP_H
+#define __RATE_GROUP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Rate-group executive statistics */
+typedef struct {
+  uint32_t frames;              // Dispatcher frames completed
+  uint32_t fusion_runs;         // Fusion phase executions
+  uint32_t telemetry_runs;      // Telemetry phase executions
+  uint32_t frame_overruns;      // Phase chain exceeded one sample period
+} RateGroupStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Subrate divisors - derived from the rates in main.h, which must stay
+ * exact harmonics of the sample rate for the phase schedule to hold */
+#define RATE_GROUP_FUSION_DIV       (SENSOR_SAMPLE_RATE_HZ / FUSION_UPDATE_RATE_HZ)
+#define RATE_GROUP_TELEMETRY_DIV    (SENSOR_SAMPLE_RATE_HZ / TELEMETRY_RATE_HZ)
+
+/* Subrate phase periods in wall time. The dispatcher triggers the
+ * phases on elapsed time, not frame counts: adaptive idle stretches
+ * the frame cadence to SENSOR_IDLE_PERIOD_MS, and frame-count division
+ * there would starve the subrate phases and their watchdog heartbeats */
+#define RATE_GROUP_FUSION_PERIOD_MS    (1000 / FUSION_UPDATE_RATE_HZ)
+#define RATE_GROUP_TELEMETRY_PERIOD_MS (1000 / TELEMETRY_RATE_HZ)
+
+#if (SENSOR_SAMPLE_RATE_HZ % FUSION_UPDATE_RATE_HZ) != 0
+#error "FUSION_UPDATE_RATE_HZ must divide SENSOR_SAMPLE_RATE_HZ"
+#endif
+#if (SENSOR_SAMPLE_RATE_HZ % TELEMETRY_RATE_HZ) != 0
+#error "TELEMETRY_RATE_HZ must divide SENSOR_SAMPLE_RATE_HZ"
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the rate-group dispatcher task
+ * @retval BaseType_t
+ */
+BaseType_t RateGroup_CreateTask(void);
+
+/**
+ * @brief  Get rate-group executive statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void RateGroup_GetStats(RateGroupStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RATE_GROUP_H */
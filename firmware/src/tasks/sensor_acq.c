@@ -10,13 +10,23 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "sensor_acq.h"
+#include "sensor_ring.h"
+#include "sram2.h"
 #include "lsm6dsl.h"
+#include "lps22hb.h"
+#include "hts221.h"
+#include "fusion.h"
+#include "watchdog.h"
+#include "fastlog.h"
+#include "profiling.h"
+#include "latency.h"
+#include "replay.h"
+#include "itm_trace.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
 #include "semphr.h"
 #include <string.h>
-#include <stdio.h>
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -25,20 +35,53 @@
 #define SENSOR_ACQ_QUEUE_SIZE         10
 #define SENSOR_MAX_RETRY_COUNT        3
 
+/* 环境传感器ODR为1Hz级, 每N个IMU周期读取一次, 其余周期复用缓存值 */
+#define SENSOR_ENV_READ_DIV           SENSOR_SAMPLE_RATE_HZ
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static TaskHandle_t xSensorAcqTaskHandle = NULL;
+#if !RATE_GROUP_SCHEDULER
+static StaticTask_t xSensorAcqTaskTCB;
+/* 采集任务栈钉在SRAM2: 零等待访问 + 奇偶校验保护 */
+SRAM2_BSS static StackType_t xSensorAcqTaskStack[SENSOR_ACQ_TASK_STACK_SIZE];
+#endif
 static SensorAcqStats_t xSensorStats = {0};
 static uint8_t ucSensorEnabled = 0;
 static LSM6DSL_Config_t xIMUConfig = {0};
 
+/* 环境传感器状态与最近一次读取的缓存值 */
+static uint8_t ucEnvSensorsReady = 0;
+static uint32_t ulEnvCycleCount = 0;
+static LPS22HB_Data_t xLastPressure = {0};
+static HTS221_Data_t xLastHumidity = {0};
+
+/* 自适应采样状态: 静止检测窗口与低速率空闲模式. 阈值预换算为原始计数,
+ * 静止判定在整数域完成, 不触碰浮点转换 */
+#if SENSOR_ADAPTIVE_SAMPLING
+static uint8_t ucLowPowerMode = 0;
+static uint32_t ulLastMotionTick = 0;
+static int16_t sStillRefAccel[3] = {0};
+static int32_t lStillGyroLimit = 0;
+static int32_t lStillAccelLimit = 0;
+#endif
+
+/* 帧内错误重试与首样本标记 (任务循环局部状态, 速率组模式下跨相位保持) */
+static uint8_t ucRetryCount = 0;
+static uint8_t ucFirstSamplePending = 1;
+
 /* Private function prototypes -----------------------------------------------*/
+#if !RATE_GROUP_SCHEDULER
 static void SensorAcqTask(void *pvParameters);
+#endif
 static HAL_StatusTypeDef SensorAcq_ReadIMU(SensorData_t *sensor_data);
-static HAL_StatusTypeDef SensorAcq_ReadPressure(SensorData_t *sensor_data);
-static HAL_StatusTypeDef SensorAcq_ReadHumidity(SensorData_t *sensor_data);
+static HAL_StatusTypeDef SensorAcq_ReadEnvironment(SensorData_t *sensor_data);
 static void SensorAcq_UpdateStats(uint32_t sample_time);
-static void SensorAcq_LogError(const char *error_msg);
+#if SENSOR_ADAPTIVE_SAMPLING
+static void SensorAcq_UpdateMotionState(const SensorData_t *sensor_data);
+static void SensorAcq_EnterIdle(void);
+static void SensorAcq_ExitIdle(void);
+#endif
 
 /* Private user code ---------------------------------------------------------*/
 
@@ -54,28 +97,125 @@ HAL_StatusTypeDef SensorAcq_Init(void)
   memset(&xSensorStats, 0, sizeof(SensorAcqStats_t));
   xSensorStats.state = SENSOR_ACQ_INIT;
 
+#ifdef REPLAY_BUILD
+  /* Replay harness: the data source is the recorded dataset - no IMU or
+   * environmental sensor hardware is touched, so the pipeline input is
+   * fully deterministic */
+  {
+    float accel_lsb = 0.0f, gyro_lsb = 0.0f;
+
+    if (Replay_Init() != HAL_OK) {
+      xSensorStats.state = SENSOR_ACQ_ERROR;
+      return HAL_ERROR;
+    }
+    Replay_GetScale(&accel_lsb, &gyro_lsb);
+    SensorScale_Set(0, accel_lsb, gyro_lsb);
+    ucEnvSensorsReady = 0;
+  }
+  return HAL_OK;
+#else
+
   /* Configure LSM6DSL IMU */
+#ifdef LSM6DSL_FIXED_CONFIG
+  /* Fixed profile (build.py --profile): rate/scale registers and the
+   * sensitivity constants are baked into the driver at compile time. The
+   * struct is still filled from the same macros so the adaptive-idle
+   * path restores the correct full-rate ODR. */
+  xIMUConfig.accel_odr = LSM6DSL_FIXED_ACCEL_ODR;
+  xIMUConfig.accel_fs = LSM6DSL_FIXED_ACCEL_FS;
+  xIMUConfig.gyro_odr = LSM6DSL_FIXED_GYRO_ODR;
+  xIMUConfig.gyro_fs = LSM6DSL_FIXED_GYRO_FS;
+#if SENSOR_USE_IMU_FIFO
+  xIMUConfig.fifo_enable = 1;
+  xIMUConfig.fifo_watermark = SENSOR_FIFO_WATERMARK;
+#else
+  xIMUConfig.fifo_enable = 0;
+  xIMUConfig.fifo_watermark = 0;
+#endif
+#elif SENSOR_USE_IMU_FIFO
+  /* High-rate vibration mode: hardware FIFO batches samples on-chip and
+   * the task drains them in one burst read per watermark */
+  xIMUConfig.accel_odr = LSM6DSL_XL_ODR_416_HZ;
+  xIMUConfig.accel_fs = LSM6DSL_XL_FS_2G;
+  xIMUConfig.gyro_odr = LSM6DSL_GY_ODR_416_HZ;
+  xIMUConfig.gyro_fs = LSM6DSL_GY_FS_250_DPS;
+  xIMUConfig.fifo_enable = 1;
+  xIMUConfig.fifo_watermark = SENSOR_FIFO_WATERMARK;
+#else
   xIMUConfig.accel_odr = LSM6DSL_XL_ODR_104_HZ;
   xIMUConfig.accel_fs = LSM6DSL_XL_FS_2G;
   xIMUConfig.gyro_odr = LSM6DSL_GY_ODR_104_HZ;
   xIMUConfig.gyro_fs = LSM6DSL_GY_FS_250_DPS;
   xIMUConfig.fifo_enable = 0;
+  xIMUConfig.fifo_watermark = 0;
+#endif
 
   /* Initialize LSM6DSL */
   status = LSM6DSL_Init(&xIMUConfig);
   if (status != HAL_OK) {
-    SensorAcq_LogError("LSM6DSL initialization failed");
+    Log_Write(LOG_ID_SENSOR_INIT_FAILED, (uint32_t)status, 0);
+    xSensorStats.state = SENSOR_ACQ_ERROR;
+    return status;
+  }
+
+  /* Publish the raw-to-physical scale factors for the lazy accessors.
+   * Full scale never changes at run time (idle mode only switches ODR),
+   * so one table slot covers every sample (scale_id = 0). */
+  {
+    float accel_lsb = 0.0f, gyro_lsb = 0.0f;
+
+    LSM6DSL_GetScale(&accel_lsb, &gyro_lsb);
+    SensorScale_Set(0, accel_lsb, gyro_lsb);
+#if SENSOR_ADAPTIVE_SAMPLING
+    /* Stillness thresholds converted once into raw counts */
+    lStillGyroLimit = (int32_t)(SENSOR_STILL_GYRO_RAD_S / gyro_lsb);
+    lStillAccelLimit = (int32_t)(SENSOR_STILL_ACCEL_MS2 / accel_lsb);
+#endif
+  }
+
+  /* Route the data-ready (or FIFO watermark) signal to INT1 so the
+   * acquisition task is woken by the sensor instead of polling STATUS_REG */
+#if SENSOR_USE_IMU_FIFO
+  status = LSM6DSL_ConfigInterrupt(LSM6DSL_INT1_FTH);
+#else
+  status = LSM6DSL_ConfigInterrupt(LSM6DSL_INT1_DRDY_XL);
+#endif
+  if (status != HAL_OK) {
+    Log_Write(LOG_ID_SENSOR_INT1_CONFIG_FAILED, (uint32_t)status, 0);
     xSensorStats.state = SENSOR_ACQ_ERROR;
     return status;
   }
 
-  /* TODO: Initialize LPS22HB pressure sensor */
-  /* TODO: Initialize HTS221 humidity sensor */
+  /* Initialize environmental sensors at their native 1Hz rate; a failure
+   * degrades to IMU-only operation instead of taking the pipeline down */
+  {
+    LPS22HB_Config_t press_config = { .odr = LPS22HB_ODR_1_HZ };
+    HTS221_Config_t hum_config = { .odr = HTS221_ODR_1_HZ };
+
+    ucEnvSensorsReady = 0;
+    if (LPS22HB_Init(&press_config) != HAL_OK) {
+      Log_Write(LOG_ID_ENV_INIT_FAILED, 0, 0);
+    } else if (HTS221_Init(&hum_config) != HAL_OK) {
+      Log_Write(LOG_ID_ENV_INIT_FAILED, 1, 0);
+    } else {
+      ucEnvSensorsReady = 1;
+    }
+    ulEnvCycleCount = 0;
+  }
+
+#if SENSOR_ADAPTIVE_SAMPLING
+  /* 初始化(或重初始化)后总是从全速率开始 */
+  ucLowPowerMode = 0;
+  xSensorStats.low_power_mode = 0;
+  ulLastMotionTick = xTaskGetTickCount();
+#endif
 
   xSensorStats.state = SENSOR_ACQ_INIT;
   return HAL_OK;
+#endif /* REPLAY_BUILD */
 }
 
+#if !RATE_GROUP_SCHEDULER
 /**
  * @brief  创建传感器采集任务
  * @retval BaseType_t
@@ -84,18 +224,20 @@ BaseType_t SensorAcq_CreateTask(void)
 {
   BaseType_t result = pdPASS;
 
-  /* 创建传感器采集任务 */
-  result = xTaskCreate(SensorAcqTask, 
-                       "SensorAcq", 
-                       SENSOR_ACQ_TASK_STACK_SIZE, 
-                       NULL, 
-                       SENSOR_ACQ_TASK_PRIORITY, 
-                       &xSensorAcqTaskHandle);
+  /* 创建传感器采集任务 (静态分配) */
+  xSensorAcqTaskHandle = xTaskCreateStatic(SensorAcqTask,
+                                           "SensorAcq",
+                                           SENSOR_ACQ_TASK_STACK_SIZE,
+                                           NULL,
+                                           SENSOR_ACQ_TASK_PRIORITY,
+                                           xSensorAcqTaskStack,
+                                           &xSensorAcqTaskTCB);
+  result = (xSensorAcqTaskHandle != NULL) ? pdPASS : pdFAIL;
 
   if (result == pdPASS) {
-    SensorAcq_LogError("SensorAcq task created successfully");
+    Log_Write(LOG_ID_SENSOR_TASK_CREATED, 0, 0);
   } else {
-    SensorAcq_LogError("Failed to create SensorAcq task");
+    Log_Write(LOG_ID_SENSOR_TASK_CREATE_FAILED, 0, 0);
   }
 
   return result;
@@ -108,74 +250,195 @@ BaseType_t SensorAcq_CreateTask(void)
  */
 static void SensorAcqTask(void *pvParameters)
 {
-  TickType_t xLastWakeTime;
-  const TickType_t xFrequency = pdMS_TO_TICKS(SENSOR_SAMPLE_PERIOD_MS);
-  SensorData_t sensor_data = {0};
-  HAL_StatusTypeDef status = HAL_OK;
-  uint8_t retry_count = 0;
+  SensorAcq_TaskSetup();
+
+  /* 主任务循环 */
+  for (;;) {
+    SensorAcq_WaitFrame();
+    SensorAcq_RunFrame();
+  }
+}
+#endif /* RATE_GROUP_SCHEDULER */
+
+/**
+ * @brief  在宿主任务上下文中建立采集环境 (独立任务或速率组调度器)
+ * @retval None
+ */
+void SensorAcq_TaskSetup(void)
+{
+  /* INT1通知路由到调用者: 独立任务模式即采集任务本身,
+   * 速率组模式为调度器任务 */
+  xSensorAcqTaskHandle = xTaskGetCurrentTaskHandle();
+
+  /* 快速启动: 驱动初始化在任务上下文进行, LSM6DSL复位等待 (vTaskDelay)
+   * 期间其余任务并行完成各自的初始化. 现场掉电重启时失败重试而不是
+   * 挂起整个系统 */
+  while (SensorAcq_Init() != HAL_OK) {
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
 
-  /* 初始化周期性任务 */
-  xLastWakeTime = xTaskGetTickCount();
+  SensorRing_Reset();
   xSensorStats.state = SENSOR_ACQ_RUNNING;
   ucSensorEnabled = 1;
 
-  SensorAcq_LogError("SensorAcq task started");
+  Log_Write(LOG_ID_SENSOR_TASK_STARTED, 0, 0);
+}
 
-  /* 主任务循环 */
-  for (;;) {
-    if (ucSensorEnabled) {
-      uint32_t sample_start_time = xTaskGetTickCount();
-      
-      /* 清除传感器数据 */
-      memset(&sensor_data, 0, sizeof(SensorData_t));
-      sensor_data.timestamp = sample_start_time;
-
-      /* 读取IMU数据 */
-      status = SensorAcq_ReadIMU(&sensor_data);
-      if (status == HAL_OK) {
-        /* 读取压力传感器数据 */
-        status = SensorAcq_ReadPressure(&sensor_data);
+/**
+ * @brief  等待下一个采样帧节拍 (INT1通知/空闲保活/回放节拍)
+ * @retval None
+ */
+void SensorAcq_WaitFrame(void)
+{
+#ifdef REPLAY_BUILD
+  /* 回放构建: 不等INT1, 每tick供一个样本 - 100Hz的记录流以1kHz
+   * 回放, 比实时快一个数量级; 延时一个tick保证低优先级的流水线
+   * 任务不被饿死 */
+  vTaskDelay(1);
+#elif SENSOR_ADAPTIVE_SAMPLING
+  if (ucLowPowerMode) {
+    /* 空闲模式: INT1上挂的是硬件唤醒事件; 通知到达说明检测到运动,
+     * 一个采样周期内恢复全速率; 超时则做一次低速率保活采样 */
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SENSOR_IDLE_PERIOD_MS)) != 0) {
+      SensorAcq_ExitIdle();
+    }
+  } else if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SENSOR_SAMPLE_PERIOD_MS * 2)) == 0) {
+    /* 等待INT1数据就绪通知; 超时兜底保证丢失边沿时任务不会卡死 */
+    xSensorStats.missed_interrupts++;
+  }
+#else
+  /* 等待INT1数据就绪通知; 超时兜底保证丢失边沿时任务不会卡死 */
+  if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SENSOR_SAMPLE_PERIOD_MS * 2)) == 0) {
+    xSensorStats.missed_interrupts++;
+  }
+#endif
+}
+
+/**
+ * @brief  执行一个采集帧: 读取传感器, 提交样本并发布到各消费路径
+ * @retval uint8_t 1-本帧提交了有效样本, 0-未提交
+ */
+uint8_t SensorAcq_RunFrame(void)
+{
+  SensorData_t *sensor_data = NULL;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t committed = 0;
+
+  /* 心跳: 单次事件组置位, 看门狗据此判定采集任务存活 */
+  Watchdog_TaskAlive(WATCHDOG_BIT_SENSOR);
+
+  if (ucSensorEnabled) {
+    uint32_t sample_start_time = xTaskGetTickCount();
+    uint32_t stage_start_cycles = Profiling_GetCycles();
+
+    TRACE_SAMPLE_START(sample_start_time);
+
+    /* 在环形缓冲区槽位中就地写入, 消费者就地读取, 全程零拷贝 */
+    sensor_data = SensorRing_Claim();
+    memset(sensor_data, 0, sizeof(SensorData_t));
+    sensor_data->timestamp = sample_start_time;
+
+    /* 读取IMU数据 (DWT周期计数) */
+    Profiling_SectionEnter(PROF_SECTION_IMU_READ);
+    status = SensorAcq_ReadIMU(sensor_data);
+    Profiling_SectionExit(PROF_SECTION_IMU_READ);
+    if (status == HAL_OK) {
+      /* 按环境传感器自身ODR读取压力/湿度, 其余周期复用缓存 */
+      status = SensorAcq_ReadEnvironment(sensor_data);
+    }
+
+    if (status == HAL_OK) {
+      SensorRingIndex_t slot_index;
+
+      sensor_data->data_valid = 1;
+      ucRetryCount = 0;
+      committed = 1;
+
+      if (ucFirstSamplePending) {
+        /* 启动指标: 调度器启动到首个有效样本提交的耗时 */
+        ucFirstSamplePending = 0;
+        xSensorStats.first_sample_ms = sample_start_time;
+        Log_Write(LOG_ID_BOOT_FIRST_SAMPLE, sample_start_time, 0);
       }
-      
-      if (status == HAL_OK) {
-        /* 读取湿度传感器数据 */
-        status = SensorAcq_ReadHumidity(&sensor_data);
+
+      /* 发布槽位, 仅传递16位索引 */
+      slot_index = SensorRing_Commit();
+
+      /* 控制路径: 最新值邮箱, 覆盖旧值而不是阻塞 */
+      if (uxQueueSpacesAvailable(xSensorMailbox) == 0) {
+        xSensorStats.mailbox_overwrites++;
       }
+      xQueueOverwrite(xSensorMailbox, &slot_index);
+
+      /* 融合路径: 任务通知直传索引 (单生产者单消费者, 无队列开销) */
+      Fusion_SubmitSample(slot_index);
 
-      if (status == HAL_OK) {
-        sensor_data.data_valid = 1;
-        retry_count = 0;
+      /* 遥测路径: 队列, 满时淘汰最旧样本, 热路径零等待 */
+      if (xQueueSend(xSensorDataQueue, &slot_index, 0) != pdPASS) {
+        SensorRingIndex_t stale_index;
 
-        /* 发送数据到融合任务 */
-        if (xQueueSend(xSensorDataQueue, &sensor_data, pdMS_TO_TICKS(10)) != pdPASS) {
-          SensorAcq_LogError("Failed to send sensor data to queue");
+        xQueueReceive(xSensorDataQueue, &stale_index, 0);
+        xSensorStats.dropped_oldest++;
+        if (xQueueSend(xSensorDataQueue, &slot_index, 0) != pdPASS) {
           xSensorStats.error_count++;
+          Log_Write(LOG_ID_SENSOR_QUEUE_SEND_FAILED, xSensorStats.error_count, 0);
         }
+      }
+
+      /* 采集阶段延迟直方图 (读取到入队) */
+      Latency_Record(LAT_STAGE_ACQUISITION, stage_start_cycles);
+      TRACE_SAMPLE_DONE(xTaskGetTickCount());
 
-        /* 更新统计信息 */
-        SensorAcq_UpdateStats(sample_start_time);
-      } else {
-        /* 处理错误 */
-        retry_count++;
-        xSensorStats.error_count++;
-        
-        if (retry_count >= SENSOR_MAX_RETRY_COUNT) {
-          SensorAcq_LogError("Max sensor read retries exceeded");
-          xSensorStats.state = SENSOR_ACQ_ERROR;
-          retry_count = 0;
-          
-          /* 尝试重新初始化传感器 */
-          if (SensorAcq_Init() == HAL_OK) {
-            xSensorStats.state = SENSOR_ACQ_RUNNING;
-            SensorAcq_LogError("Sensor reinitialized successfully");
-          }
+      /* 更新统计信息 */
+      SensorAcq_UpdateStats(sample_start_time);
+
+#if SENSOR_CAPTURE_STREAM
+      /* 捕获流: 原始样本打包进二进制日志通道, 主机侧
+       * tools/replay_capture.py 还原为回放数据集 */
+      Replay_CaptureSample(sensor_data);
+#endif
+
+#if SENSOR_ADAPTIVE_SAMPLING
+      /* 静止检测: 长时间无运动则切换到低速率空闲模式 */
+      if (!ucLowPowerMode) {
+        SensorAcq_UpdateMotionState(sensor_data);
+      }
+#endif
+    } else {
+      /* 处理错误 */
+      ucRetryCount++;
+      xSensorStats.error_count++;
+
+      if (ucRetryCount >= SENSOR_MAX_RETRY_COUNT) {
+        Log_Write(LOG_ID_SENSOR_MAX_RETRIES, xSensorStats.error_count, 0);
+        xSensorStats.state = SENSOR_ACQ_ERROR;
+        ucRetryCount = 0;
+
+        /* 尝试重新初始化传感器 */
+        if (SensorAcq_Init() == HAL_OK) {
+          xSensorStats.state = SENSOR_ACQ_RUNNING;
+          Log_Write(LOG_ID_SENSOR_REINIT_OK, 0, 0);
         }
       }
     }
+  }
+
+  return committed;
+}
+
+/**
+ * @brief  INT1数据就绪ISR回调 - 直接通知采集任务
+ * @retval None
+ */
+void SensorAcq_DataReadyISR(void)
+{
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
-    /* 等待下一个采样周期 */
-    vTaskDelayUntil(&xLastWakeTime, xFrequency);
+  if (xSensorAcqTaskHandle != NULL) {
+    vTaskNotifyGiveFromISR(xSensorAcqTaskHandle, &xHigherPriorityTaskWoken);
   }
+
+  portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
 /**
@@ -186,24 +449,52 @@ static void SensorAcqTask(void *pvParameters)
 static HAL_StatusTypeDef SensorAcq_ReadIMU(SensorData_t *sensor_data)
 {
   HAL_StatusTypeDef status = HAL_OK;
-  LSM6DSL_Data_t imu_data = {0};
+  LSM6DSL_RawSample_t imu_data = {0};
+
+#ifdef REPLAY_BUILD
+  /* 回放构建: 从记录数据集取下一帧, 不上I2C总线 */
+  status = Replay_ReadSample(&imu_data);
+#elif SENSOR_USE_IMU_FIFO
+  /* FIFO批量模式: 一次突发读取排空片上FIFO, 流水线使用最新样本 */
+  static LSM6DSL_RawSample_t fifo_batch[SENSOR_FIFO_WATERMARK];
+  uint16_t fifo_count = 0;
+
+  status = LSM6DSL_ReadFIFORaw(fifo_batch, SENSOR_FIFO_WATERMARK, &fifo_count);
+  if (status != HAL_OK) {
+    return status;
+  }
+  if (fifo_count == 0) {
+    return HAL_OK;  // 水位线未到, 不是错误
+  }
 
-  /* 读取LSM6DSL数据 */
-  status = LSM6DSL_ReadData(&imu_data);
+  imu_data = fifo_batch[fifo_count - 1];
+  if (fifo_count > 1) {
+    xSensorStats.total_samples += (uint32_t)(fifo_count - 1);
+  }
+#else
+  /* 读取LSM6DSL原始数据 (热路径不做单位转换) */
+  status = LSM6DSL_ReadDataRaw(&imu_data);
+#endif
   if (status == HAL_OK && imu_data.data_ready) {
-    /* 复制加速度数据 */
-    sensor_data->accel_x = imu_data.accel_x;
-    sensor_data->accel_y = imu_data.accel_y;
-    sensor_data->accel_z = imu_data.accel_z;
-
-    /* 复制陀螺仪数据 */
-    sensor_data->gyro_x = imu_data.gyro_x;
-    sensor_data->gyro_y = imu_data.gyro_y;
-    sensor_data->gyro_z = imu_data.gyro_z;
-
-    /* 复制温度数据（如果有效） */
-    if (imu_data.temperature != 0.0f) {
-      sensor_data->temperature = imu_data.temperature;
+    /* 原始计数直通流水线, 物理量转换推迟到需要的消费者 */
+    sensor_data->accel_raw[0] = imu_data.accel[0];
+    sensor_data->accel_raw[1] = imu_data.accel[1];
+    sensor_data->accel_raw[2] = imu_data.accel[2];
+
+    sensor_data->gyro_raw[0] = imu_data.gyro[0];
+    sensor_data->gyro_raw[1] = imu_data.gyro[1];
+    sensor_data->gyro_raw[2] = imu_data.gyro[2];
+
+    sensor_data->scale_id = 0;
+
+#ifdef REPLAY_BUILD
+    /* 回放: 时间戳切换到记录时间域, 下游融合积分的dt与现场一致 */
+    sensor_data->timestamp = imu_data.timestamp;
+#endif
+
+    /* IMU温度为1Hz级辅助量, 在此转换 (FIFO模式无温度通道) */
+    if (imu_data.temperature != 0) {
+      sensor_data->temperature = 25.0f + (float)imu_data.temperature / 256.0f;
     }
   } else if (status == HAL_OK && !imu_data.data_ready) {
     /* 数据未准备就绪，不是错误 */
@@ -214,34 +505,128 @@ static HAL_StatusTypeDef SensorAcq_ReadIMU(SensorData_t *sensor_data)
 }
 
 /**
- * @brief  读取压力传感器数据
+ * @brief  读取环境传感器数据 (LPS22HB + HTS221, ODR感知调度)
  * @param  sensor_data: 传感器数据结构
  * @retval HAL_StatusTypeDef
  */
-static HAL_StatusTypeDef SensorAcq_ReadPressure(SensorData_t *sensor_data)
+static HAL_StatusTypeDef SensorAcq_ReadEnvironment(SensorData_t *sensor_data)
 {
-  /* TODO: 实现LPS22HB压力传感器读取 */
-  /* 暂时使用模拟数据 */
-  sensor_data->pressure = 1013.25f + (float)(rand() % 100 - 50) / 10.0f;
+  /* 1Hz级传感器只在到期周期上总线, 两次读取合并为一个总线事务 */
+  if (ucEnvSensorsReady && (ulEnvCycleCount % SENSOR_ENV_READ_DIV) == 0) {
+    I2CBusOp_t ops[2];
+    I2CBusTransaction_t txn = {ops, 2, NULL, HAL_OK};
+
+    LPS22HB_PrepareReadOp(&ops[0]);
+    HTS221_PrepareReadOp(&ops[1]);
+
+    if (I2CBus_Submit(&txn) == HAL_OK) {
+      LPS22HB_ParseData(&xLastPressure);
+      HTS221_ParseData(&xLastHumidity);
+    } else {
+      /* 读取失败保留缓存值, 记录后继续 */
+      Log_Write(LOG_ID_ENV_READ_FAILED, (uint32_t)txn.status, 0);
+    }
+  }
+  ulEnvCycleCount++;
+
+  sensor_data->pressure = xLastPressure.pressure;
+  sensor_data->humidity = xLastHumidity.humidity;
+  if (sensor_data->temperature == 0.0f) {
+    /* IMU温度无效时退回HTS221温度 */
+    sensor_data->temperature = xLastHumidity.temperature;
+  }
+
   return HAL_OK;
 }
 
+#if SENSOR_ADAPTIVE_SAMPLING
 /**
- * @brief  读取湿度传感器数据
- * @param  sensor_data: 传感器数据结构
- * @retval HAL_StatusTypeDef
+ * @brief  静止检测: 连续静止超时后进入空闲模式
+ * @param  sensor_data: 本周期样本
+ * @retval None
  */
-static HAL_StatusTypeDef SensorAcq_ReadHumidity(SensorData_t *sensor_data)
+static void SensorAcq_UpdateMotionState(const SensorData_t *sensor_data)
 {
-  /* TODO: 实现HTS221湿度传感器读取 */
-  /* 暂时使用模拟数据 */
-  sensor_data->humidity = 45.0f + (float)(rand() % 200 - 100) / 10.0f;
-  if (sensor_data->temperature == 0.0f) {
-    sensor_data->temperature = 22.0f + (float)(rand() % 100 - 50) / 10.0f;
+  uint8_t still = 1;
+  int32_t delta;
+
+  /* 每轴角速率与加速度增量都低于阈值才算静止 (增量检测对安装姿态不敏感);
+   * 阈值已预换算为原始计数, 整个判定保持在整数域 */
+  for (uint8_t i = 0; i < 3; i++) {
+    delta = (int32_t)sensor_data->gyro_raw[i];
+    if (delta < 0) delta = -delta;
+    if (delta >= lStillGyroLimit) still = 0;
+
+    delta = (int32_t)sensor_data->accel_raw[i] - (int32_t)sStillRefAccel[i];
+    if (delta < 0) delta = -delta;
+    if (delta >= lStillAccelLimit) still = 0;
+
+    sStillRefAccel[i] = sensor_data->accel_raw[i];
   }
-  return HAL_OK;
+
+  if (!still) {
+    ulLastMotionTick = sensor_data->timestamp;
+  } else if ((sensor_data->timestamp - ulLastMotionTick) >= SENSOR_IDLE_TIMEOUT_MS) {
+    SensorAcq_EnterIdle();
+  }
+}
+
+/**
+ * @brief  进入空闲模式: 加速度计降到12.5Hz, 陀螺仪断电, 唤醒引擎接管INT1
+ * @retval None
+ */
+static void SensorAcq_EnterIdle(void)
+{
+  LSM6DSL_Config_t idle_config = xIMUConfig;
+
+  idle_config.accel_odr = LSM6DSL_XL_ODR_12_5_HZ;
+  idle_config.gyro_odr = LSM6DSL_GY_ODR_POWER_DOWN;
+
+  /* 顺序: 先断开DRDY路由再降速, 避免残留边沿被误判为唤醒事件 */
+  if (LSM6DSL_ConfigInterrupt(0x00) != HAL_OK ||
+      LSM6DSL_SetDataRate(&idle_config) != HAL_OK ||
+      LSM6DSL_ConfigWakeUp(SENSOR_WAKE_THRESHOLD, SENSOR_WAKE_DURATION) != HAL_OK ||
+      LSM6DSL_RouteWakeUp(1) != HAL_OK) {
+    /* 任一步失败: 恢复全速率, 下个静止窗口再试 */
+    LSM6DSL_SetDataRate(&xIMUConfig);
+    LSM6DSL_ConfigInterrupt(LSM6DSL_INT1_DRDY_XL);
+    return;
+  }
+
+  /* 丢弃切换期间挂起的DRDY通知 */
+  ulTaskNotifyTake(pdTRUE, 0);
+
+  ucLowPowerMode = 1;
+  xSensorStats.low_power_mode = 1;
+  xSensorStats.idle_entries++;
+  ulLastMotionTick = xTaskGetTickCount();
+  Log_Write(LOG_ID_SENSOR_IDLE_ENTER, SENSOR_IDLE_TIMEOUT_MS, 0);
 }
 
+/**
+ * @brief  退出空闲模式: 恢复全速率采样与DRDY中断
+ * @retval None
+ */
+static void SensorAcq_ExitIdle(void)
+{
+  uint8_t wake_src = 0;
+
+  /* 读取并清除锁存的唤醒事件 */
+  LSM6DSL_GetWakeUpSource(&wake_src);
+
+  LSM6DSL_RouteWakeUp(0);
+  LSM6DSL_SetDataRate(&xIMUConfig);
+  LSM6DSL_ConfigInterrupt(LSM6DSL_INT1_DRDY_XL);
+
+  ucLowPowerMode = 0;
+  xSensorStats.low_power_mode = 0;
+  xSensorStats.motion_wakeups++;
+  ulLastMotionTick = xTaskGetTickCount();
+  sStillRefAccel[0] = sStillRefAccel[1] = sStillRefAccel[2] = 0;
+  Log_Write(LOG_ID_SENSOR_WAKE_MOTION, wake_src, 0);
+}
+#endif /* SENSOR_ADAPTIVE_SAMPLING */
+
 /**
  * @brief  更新传感器采集统计信息
  * @param  sample_time: 采样时间戳
@@ -265,21 +650,6 @@ static void SensorAcq_UpdateStats(uint32_t sample_time)
   }
 }
 
-/**
- * @brief  记录传感器错误日志
- * @param  error_msg: 错误消息
- * @retval None
- */
-static void SensorAcq_LogError(const char *error_msg)
-{
-  char log_buffer[128];
-  snprintf(log_buffer, sizeof(log_buffer), "[SensorAcq] %s (Tick: %lu)\r\n", 
-           error_msg, xTaskGetTickCount());
-  
-  /* 通过UART输出日志 */
-  HAL_UART_Transmit(&huart1, (uint8_t *)log_buffer, strlen(log_buffer), 100);
-}
-
 /**
  * @brief  获取传感器采集统计信息
  * @param  stats: 返回的统计信息
@@ -303,6 +673,8 @@ void SensorAcq_ResetStats(void)
   taskENTER_CRITICAL();
   xSensorStats.total_samples = 0;
   xSensorStats.error_count = 0;
+  xSensorStats.mailbox_overwrites = 0;
+  xSensorStats.dropped_oldest = 0;
   xSensorStats.sample_rate = 0.0f;
   taskEXIT_CRITICAL();
 }
@@ -322,14 +694,14 @@ HAL_StatusTypeDef SensorAcq_Enable(uint8_t enable)
     if (status == HAL_OK) {
       ucSensorEnabled = 1;
       xSensorStats.state = SENSOR_ACQ_RUNNING;
-      SensorAcq_LogError("Sensor acquisition enabled");
+      Log_Write(LOG_ID_SENSOR_ENABLED, 0, 0);
     }
   } else if (!enable && ucSensorEnabled) {
     /* 停止传感器 */
     status = LSM6DSL_Enable(0);
     ucSensorEnabled = 0;
     xSensorStats.state = SENSOR_ACQ_STOPPED;
-    SensorAcq_LogError("Sensor acquisition disabled");
+    Log_Write(LOG_ID_SENSOR_DISABLED, 0, 0);
   }
 
   return status;
@@ -33,6 +33,13 @@ typedef enum {
 typedef struct {
   uint32_t total_samples;
   uint32_t error_count;
+  uint32_t missed_interrupts;
+  uint32_t mailbox_overwrites;  // Control mailbox: stale sample replaced
+  uint32_t dropped_oldest;      // Telemetry queue: oldest sample evicted
+  uint32_t idle_entries;        // Adaptive mode: transitions to low-rate idle
+  uint32_t motion_wakeups;      // Adaptive mode: hardware wake-up events
+  uint8_t low_power_mode;       // Adaptive mode: currently idling
+  uint32_t first_sample_ms;     // Scheduler start to first valid sample
   uint32_t last_sample_time;
   float sample_rate;
   SensorAcqState_t state;
@@ -41,6 +48,34 @@ typedef struct {
 /* Exported constants --------------------------------------------------------*/
 #define SENSOR_SAMPLE_PERIOD_MS     (1000 / SENSOR_SAMPLE_RATE_HZ)
 
+/* IMU hardware FIFO batch mode - enables 416Hz ODR for vibration analysis
+ * with one burst read per watermark instead of one I2C transaction per sample */
+#ifndef SENSOR_USE_IMU_FIFO
+#define SENSOR_USE_IMU_FIFO         0
+#endif
+#define SENSOR_FIFO_WATERMARK       20    // Samples per FIFO drain
+
+/* Motion-adaptive sampling - when the device sits still the IMU drops to a
+ * low ODR with the gyro powered down and the task stretches its period; the
+ * LSM6DSL hardware wake-up engine snaps it back to full rate on motion.
+ * Not combined with FIFO batch mode (that build is for continuous vibration
+ * capture where idling defeats the purpose). */
+#ifndef SENSOR_ADAPTIVE_SAMPLING
+#ifdef REPLAY_BUILD
+/* Replay runs faster than real time; rate switching would only distort
+ * the recorded timeline */
+#define SENSOR_ADAPTIVE_SAMPLING    0
+#else
+#define SENSOR_ADAPTIVE_SAMPLING    (!SENSOR_USE_IMU_FIFO)
+#endif
+#endif
+#define SENSOR_IDLE_TIMEOUT_MS      5000  // Stillness time before idling
+#define SENSOR_IDLE_PERIOD_MS       1000  // Keep-alive sample period when idle
+#define SENSOR_WAKE_THRESHOLD       2     // WAKE_UP_THS LSB = FS/64 (62.5mg @ ±2g)
+#define SENSOR_WAKE_DURATION        0     // Fire on the first sample above threshold
+#define SENSOR_STILL_GYRO_RAD_S     0.05f // Per-axis stillness threshold
+#define SENSOR_STILL_ACCEL_MS2      0.2f  // Per-axis accel delta threshold
+
 /* Exported macro ------------------------------------------------------------*/
 
 /* Exported functions prototypes ---------------------------------------------*/
@@ -57,6 +92,31 @@ HAL_StatusTypeDef SensorAcq_Init(void);
  */
 BaseType_t SensorAcq_CreateTask(void);
 
+/* Acquisition task-loop phases, split out so the rate-group dispatcher
+ * (rate_group.c) can run them inline; the standalone acquisition task is
+ * the same three calls in a loop */
+
+/**
+ * @brief  Set up acquisition in the host task's context (routes the INT1
+ *         notification to the caller, retries driver bring-up)
+ * @retval None
+ */
+void SensorAcq_TaskSetup(void);
+
+/**
+ * @brief  Block until the next sample frame (INT1, idle keep-alive or
+ *         replay pacing)
+ * @retval None
+ */
+void SensorAcq_WaitFrame(void);
+
+/**
+ * @brief  Run one acquisition frame: read sensors, commit the sample and
+ *         publish it to the consumer paths
+ * @retval 1 if a valid sample was committed this frame
+ */
+uint8_t SensorAcq_RunFrame(void);
+
 /**
  * @brief  Get sensor acquisition statistics
  * @param  stats: returned statistics
@@ -77,6 +137,12 @@ void SensorAcq_ResetStats(void);
  */
 HAL_StatusTypeDef SensorAcq_Enable(uint8_t enable);
 
+/**
+ * @brief  IMU INT1 data-ready ISR callback (called from EXTI handler)
+ * @retval None
+ */
+void SensorAcq_DataReadyISR(void);
+
 #ifdef __cplusplus
 }
 #endif
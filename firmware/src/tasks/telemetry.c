@@ -0,0 +1,353 @@
+/**
+ ******************************************************************************
+ * @file           : telemetry.c
+ * @brief          : 遥测任务实现
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : 按TELEMETRY_RATE_HZ从传感器队列抽取最新样本, 打包为
+ *                   批量二进制帧 (时间戳增量编码 + int16定点值), 批满后
+ *                   一次性交给传输层。相比逐样本JSON发布, 批量帧把每条
+ *                   MQTT/TCP开销摊薄约10倍, 对计费NB-IoT链路尤其重要。
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "telemetry.h"
+#include "watchdog.h"
+#include "telem_spool.h"
+#include "sensor_ring.h"
+#include "latency.h"
+#include "profiling.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TELEMETRY_TASK_STACK_SIZE   TASK_STACK_SIZE_TELEMETRY
+#define TELEMETRY_TASK_PRIORITY     TASK_PRIORITY_TELEMETRY
+#define TELEMETRY_PERIOD_MS         (1000 / TELEMETRY_RATE_HZ)
+
+/* 每周期最多回放的离线帧数, 限制重连后的补发突发 */
+#define TELEMETRY_DRAIN_PER_CYCLE   2
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if !RATE_GROUP_SCHEDULER
+static TaskHandle_t xTelemetryTaskHandle = NULL;
+static StaticTask_t xTelemetryTaskTCB;
+static StackType_t xTelemetryTaskStack[TELEMETRY_TASK_STACK_SIZE];
+#endif
+
+static TelemetryStats_t xTelemetryStats = {0};
+
+/* 正在构建的帧与编码状态; pucFrame指向内部缓冲或传输层提供的
+ * 零拷贝DMA缓冲 (每帧开始时向传输层申请一次) */
+static uint8_t ucFrameBuffer[TELEM_FRAME_MAX_SIZE];
+static uint8_t *pucFrame = ucFrameBuffer;
+static uint8_t ucRecordsInFrame = 0;
+static uint32_t ulLastRecordTick = 0;
+static uint32_t ulRecordSequence = 0;
+
+/* MainTask心跳缓存 (CPU占用率/空闲堆/系统状态) */
+static TelemetryData_t xLastHeartbeat = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+#if !RATE_GROUP_SCHEDULER
+static void TelemetryTask(void *pvParameters);
+#endif
+static void Telemetry_EncodeRecord(const SensorData_t *sample);
+static void Telemetry_FinishFrame(void);
+static void Telemetry_DrainSpool(void);
+static int16_t Telemetry_ScaleToI16(float value, float scale);
+static void Telemetry_PutU16(uint8_t *dst, uint16_t value);
+static void Telemetry_PutU32(uint8_t *dst, uint32_t value);
+
+/* Private user code ---------------------------------------------------------*/
+
+#if !RATE_GROUP_SCHEDULER
+/**
+ * @brief  创建遥测任务
+ * @retval BaseType_t
+ */
+BaseType_t Telemetry_CreateTask(void)
+{
+  xTelemetryTaskHandle = xTaskCreateStatic(TelemetryTask, "Telemetry",
+                                           TELEMETRY_TASK_STACK_SIZE, NULL,
+                                           TELEMETRY_TASK_PRIORITY,
+                                           xTelemetryTaskStack,
+                                           &xTelemetryTaskTCB);
+  return (xTelemetryTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  遥测任务主函数
+ * @param  pvParameters: 任务参数
+ * @retval None
+ */
+static void TelemetryTask(void *pvParameters)
+{
+  TickType_t xLastWakeTime = xTaskGetTickCount();
+
+  Telemetry_Setup();
+
+  for (;;) {
+    vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(TELEMETRY_PERIOD_MS));
+    Telemetry_RunCycle();
+  }
+}
+#endif /* RATE_GROUP_SCHEDULER */
+
+/**
+ * @brief  遥测上下文初始化 (宿主任务启动时调用一次)
+ * @retval None
+ */
+void Telemetry_Setup(void)
+{
+  /* 重建断电前遗留的离线帧索引 */
+  TelemSpool_Init();
+}
+
+/**
+ * @brief  执行一个遥测周期: 抽取最新样本编码入帧, 回放离线帧
+ * @retval None
+ */
+void Telemetry_RunCycle(void)
+{
+  SensorRingIndex_t slot_index, latest_index;
+  uint8_t have_sample;
+
+  /* 心跳: 周期循环本身即存活证明 */
+  Watchdog_TaskAlive(WATCHDOG_BIT_TELEMETRY);
+
+  /* 排空传感器队列, 只保留最新样本 (100Hz流抽取到10Hz) */
+  have_sample = 0;
+  while (xQueueReceive(xSensorDataQueue, &slot_index, 0) == pdPASS) {
+    if (have_sample) {
+      xTelemetryStats.samples_decimated++;
+    }
+    latest_index = slot_index;
+    have_sample = 1;
+  }
+
+  /* 刷新MainTask心跳缓存 (非阻塞) */
+  while (xQueueReceive(xTelemetryQueue, &xLastHeartbeat, 0) == pdPASS) {
+  }
+
+  if (have_sample) {
+    const SensorData_t *sample = SensorRing_Get(latest_index);
+
+    if (sample != NULL && sample->data_valid) {
+      uint32_t stage_start_cycles = Profiling_GetCycles();
+
+      Telemetry_EncodeRecord(sample);
+      if (ucRecordsInFrame >= TELEM_BATCH_RECORDS) {
+        Telemetry_FinishFrame();
+      }
+
+      /* 遥测阶段延迟直方图 (编码到发布) */
+      Latency_Record(LAT_STAGE_TELEMETRY, stage_start_cycles);
+    }
+  }
+
+  /* 链路可用时后台回放离线帧 */
+  Telemetry_DrainSpool();
+}
+
+/**
+ * @brief  把一个样本编码进当前帧
+ * @param  sample: 传感器样本
+ * @retval None
+ */
+static void Telemetry_EncodeRecord(const SensorData_t *sample)
+{
+  uint8_t *record;
+  uint32_t dt;
+  float accel[3], gyro[3];
+
+  if (ucRecordsInFrame == 0) {
+    /* 新帧: 先向传输层要编码缓冲 (零拷贝路径), 拿不到就退回内部缓冲 */
+    uint32_t free_heap = (uint32_t)xPortGetFreeHeapSize();
+
+    pucFrame = Telemetry_TransportFrameBuffer();
+    if (pucFrame == NULL) {
+      pucFrame = ucFrameBuffer;
+    }
+
+    Telemetry_PutU16(&pucFrame[0], TELEM_FRAME_MAGIC);
+    pucFrame[2] = TELEM_FRAME_VERSION;
+    /* record_count 在帧完成时回填 */
+    pucFrame[3] = 0;
+    Telemetry_PutU32(&pucFrame[4], sample->timestamp);
+    Telemetry_PutU32(&pucFrame[8], ulRecordSequence);
+    pucFrame[12] = xLastHeartbeat.system_status;
+    pucFrame[13] = (uint8_t)xLastHeartbeat.cpu_usage;
+    Telemetry_PutU16(&pucFrame[14],
+                     (free_heap > 0xFFFF) ? 0xFFFF : (uint16_t)free_heap);
+    ulLastRecordTick = sample->timestamp;
+  }
+
+  record = &pucFrame[TELEM_FRAME_HEADER_SIZE +
+                     ucRecordsInFrame * TELEM_RECORD_SIZE];
+
+  /* 时间戳增量编码 (首记录为0, 上限饱和) */
+  dt = sample->timestamp - ulLastRecordTick;
+  record[0] = (dt > 0xFF) ? 0xFF : (uint8_t)dt;
+  record[1] = sample->data_valid ? 0x01 : 0x00;
+
+  /* 惰性转换为物理单位后再定点缩放, 线上格式保持不变 */
+  SensorData_GetAccel(sample, accel);
+  SensorData_GetGyro(sample, gyro);
+
+  Telemetry_PutU16(&record[2], (uint16_t)Telemetry_ScaleToI16(accel[0], TELEM_SCALE_ACCEL));
+  Telemetry_PutU16(&record[4], (uint16_t)Telemetry_ScaleToI16(accel[1], TELEM_SCALE_ACCEL));
+  Telemetry_PutU16(&record[6], (uint16_t)Telemetry_ScaleToI16(accel[2], TELEM_SCALE_ACCEL));
+  Telemetry_PutU16(&record[8], (uint16_t)Telemetry_ScaleToI16(gyro[0], TELEM_SCALE_GYRO));
+  Telemetry_PutU16(&record[10], (uint16_t)Telemetry_ScaleToI16(gyro[1], TELEM_SCALE_GYRO));
+  Telemetry_PutU16(&record[12], (uint16_t)Telemetry_ScaleToI16(gyro[2], TELEM_SCALE_GYRO));
+  Telemetry_PutU16(&record[14], (uint16_t)Telemetry_ScaleToI16(sample->temperature, TELEM_SCALE_TEMP));
+  Telemetry_PutU16(&record[16], (uint16_t)Telemetry_ScaleToI16(sample->pressure, TELEM_SCALE_PRESS));
+  Telemetry_PutU16(&record[18], (uint16_t)Telemetry_ScaleToI16(sample->humidity, TELEM_SCALE_HUM));
+
+  ulLastRecordTick = sample->timestamp;
+  ulRecordSequence++;
+  ucRecordsInFrame++;
+  xTelemetryStats.records_encoded++;
+}
+
+/**
+ * @brief  完成当前帧并交给传输层
+ * @retval None
+ */
+static void Telemetry_FinishFrame(void)
+{
+  uint16_t frame_length;
+
+  pucFrame[3] = ucRecordsInFrame;
+  frame_length = TELEM_FRAME_HEADER_SIZE +
+                 (uint16_t)ucRecordsInFrame * TELEM_RECORD_SIZE;
+
+  if (Telemetry_TransportPublish(pucFrame, frame_length) == HAL_OK) {
+    xTelemetryStats.frames_published++;
+  } else {
+    /* 链路断开: 帧转入闪存离线缓冲, 重连后回放 */
+    xTelemetryStats.publish_failures++;
+    TelemSpool_Append(pucFrame, frame_length);
+  }
+
+  /* 帧已发布或已落盘, 归还传输层缓冲 (内部缓冲时为空操作) */
+  Telemetry_TransportFrameRelease(pucFrame);
+  ucRecordsInFrame = 0;
+}
+
+/**
+ * @brief  回放离线缓冲中的帧 (每周期限量, 成功才消费)
+ * @retval None
+ */
+static void Telemetry_DrainSpool(void)
+{
+  static uint8_t spool_frame[SPOOL_SLOT_PAYLOAD_MAX];
+  uint16_t spool_length;
+
+  for (uint8_t i = 0; i < TELEMETRY_DRAIN_PER_CYCLE; i++) {
+    if (TelemSpool_PendingCount() == 0) {
+      return;
+    }
+    if (TelemSpool_Peek(spool_frame, &spool_length) != HAL_OK) {
+      return;
+    }
+    if (Telemetry_TransportPublish(spool_frame, spool_length) != HAL_OK) {
+      return;  // 链路仍不可用, 保留帧下周期再试
+    }
+    TelemSpool_Consume();
+    xTelemetryStats.frames_published++;
+  }
+}
+
+/**
+ * @brief  浮点值定点化为int16 (饱和截断)
+ * @param  value: 原始值
+ * @param  scale: 定点比例系数
+ * @retval int16_t
+ */
+static int16_t Telemetry_ScaleToI16(float value, float scale)
+{
+  float scaled = value * scale;
+
+  if (scaled > 32767.0f) {
+    return INT16_MAX;
+  }
+  if (scaled < -32768.0f) {
+    return INT16_MIN;
+  }
+  return (int16_t)scaled;
+}
+
+/**
+ * @brief  小端写入16位值
+ */
+static void Telemetry_PutU16(uint8_t *dst, uint16_t value)
+{
+  dst[0] = (uint8_t)(value & 0xFF);
+  dst[1] = (uint8_t)(value >> 8);
+}
+
+/**
+ * @brief  小端写入32位值
+ */
+static void Telemetry_PutU32(uint8_t *dst, uint32_t value)
+{
+  dst[0] = (uint8_t)(value & 0xFF);
+  dst[1] = (uint8_t)(value >> 8);
+  dst[2] = (uint8_t)(value >> 16);
+  dst[3] = (uint8_t)(value >> 24);
+}
+
+/**
+ * @brief  获取遥测统计信息
+ * @param  stats: 返回的统计信息
+ * @retval None
+ */
+void Telemetry_GetStats(TelemetryStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xTelemetryStats, sizeof(TelemetryStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
+
+/**
+ * @brief  把完成的帧交给传输层 (弱定义: 连接层上线前计数后丢弃)
+ * @param  frame: 编码后的帧缓冲区
+ * @param  length: 帧长度 (字节)
+ * @retval HAL_StatusTypeDef
+ */
+__weak HAL_StatusTypeDef Telemetry_TransportPublish(const uint8_t *frame, uint16_t length)
+{
+  (void)frame;
+  (void)length;
+  return HAL_OK;
+}
+
+/**
+ * @brief  帧编码缓冲钩子的默认实现: 返回NULL表示使用内部缓冲
+ * @retval uint8_t*
+ */
+__weak uint8_t *Telemetry_TransportFrameBuffer(void)
+{
+  return NULL;
+}
+
+/**
+ * @brief  帧缓冲释放钩子的默认实现: 空操作
+ * @param  frame: 帧缓冲
+ * @retval None
+ */
+__weak void Telemetry_TransportFrameRelease(const uint8_t *frame)
+{
+  (void)frame;
+}
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file           : telemetry.h
+ * @brief          : Telemetry task header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Batched binary telemetry encoder
+ *                  - Samples the sensor stream at TELEMETRY_RATE_HZ and packs
+ *                    TELEM_BATCH_RECORDS records into one wire frame
+ *                  - Delta-encoded timestamps (uint8 ms) and int16 scaled
+ *                    sensor values instead of floats: ~20 bytes per record
+ *                  - Frames go out through Telemetry_TransportPublish, a weak
+ *                    hook the connectivity layer overrides
+ *                  - Decoded on the host by tools/mqtt_monitor.py
+ *
+ *                   Wire format (little-endian):
+ *                     uint16 magic        TELEM_FRAME_MAGIC
+ *                     uint8  version      TELEM_FRAME_VERSION
+ *                     uint8  record_count
+ *                     uint32 base_timestamp   tick of the first record
+ *                     uint32 base_sequence    sequence of the first record
+ *                     uint8  system_status
+ *                     uint8  cpu_usage        percent
+ *                     uint16 free_heap        bytes, saturated
+ *                   then record_count records of:
+ *                     uint8  dt_ms        delta to previous record, saturated
+ *                     uint8  flags        bit0 = data_valid
+ *                     int16  accel_x/y/z  0.01 m/s² per LSB
+ *                     int16  gyro_x/y/z   0.001 rad/s per LSB
+ *                     int16  temperature  0.01 °C per LSB
+ *                     int16  pressure     0.1 hPa per LSB
+ *                     int16  humidity     0.01 %RH per LSB
+ ******************************************************************************
+ */
+
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Telemetry statistics */
+typedef struct {
+  uint32_t records_encoded;     // Records packed into frames
+  uint32_t frames_published;    // Frames handed to the transport
+  uint32_t samples_decimated;   // Sensor samples skipped by rate decimation
+  uint32_t publish_failures;    // Transport rejected a frame
+} TelemetryStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+#define TELEM_FRAME_MAGIC           0x544D  // "MT" on the wire
+#define TELEM_FRAME_VERSION         1
+#define TELEM_BATCH_RECORDS         10      // One publish per second at 10Hz
+#define TELEM_FRAME_HEADER_SIZE     16
+#define TELEM_RECORD_SIZE           20
+#define TELEM_FRAME_MAX_SIZE        (TELEM_FRAME_HEADER_SIZE + \
+                                     TELEM_BATCH_RECORDS * TELEM_RECORD_SIZE)
+
+/* Fixed-point scale factors (values multiplied before int16 truncation) */
+#define TELEM_SCALE_ACCEL           100.0f   // 0.01 m/s² per LSB
+#define TELEM_SCALE_GYRO            1000.0f  // 0.001 rad/s per LSB
+#define TELEM_SCALE_TEMP            100.0f   // 0.01 °C per LSB
+#define TELEM_SCALE_PRESS           10.0f    // 0.1 hPa per LSB
+#define TELEM_SCALE_HUM             100.0f   // 0.01 %RH per LSB
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the telemetry task
+ * @retval BaseType_t
+ */
+BaseType_t Telemetry_CreateTask(void);
+
+/**
+ * @brief  Initialize the telemetry context (spool index rebuild); called
+ *         once by the host task before the first cycle
+ * @retval None
+ */
+void Telemetry_Setup(void);
+
+/**
+ * @brief  Run one telemetry cycle: decimate the sensor stream into the
+ *         current frame and replay spooled frames (called periodically by
+ *         the telemetry task or at the telemetry subrate by the rate-group
+ *         dispatcher)
+ * @retval None
+ */
+void Telemetry_RunCycle(void);
+
+/**
+ * @brief  Get telemetry statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Telemetry_GetStats(TelemetryStats_t *stats);
+
+/**
+ * @brief  Hand a completed frame to the transport (weak, overridden by the
+ *         connectivity layer; the default build counts and discards)
+ * @param  frame: encoded frame buffer
+ * @param  length: frame length in bytes
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef Telemetry_TransportPublish(const uint8_t *frame, uint16_t length);
+
+/**
+ * @brief  Ask the transport where to encode the next frame (weak; the
+ *         connectivity layer returns a zero-copy DMA buffer so the frame
+ *         is serialized directly into the transmit path)
+ * @retval Buffer with at least TELEM_FRAME_MAX_SIZE bytes, or NULL to
+ *         fall back to the internal frame buffer
+ */
+uint8_t *Telemetry_TransportFrameBuffer(void);
+
+/**
+ * @brief  Notify the transport that the task is done with a frame buffer
+ *         obtained from Telemetry_TransportFrameBuffer (weak, no-op by
+ *         default; called after publish or spool hand-off)
+ * @param  frame: frame buffer being released
+ * @retval None
+ */
+void Telemetry_TransportFrameRelease(const uint8_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TELEMETRY_H */
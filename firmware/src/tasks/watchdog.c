@@ -0,0 +1,176 @@
+/**
+ ******************************************************************************
+ * @file           : watchdog.c
+ * @brief          : Event-group watchdog task implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "watchdog.h"
+#include "fastlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* 单个被监控任务的截止期状态 */
+typedef struct {
+  uint32_t bit;                 // 心跳位
+  uint32_t deadline_ms;         // 允许的最大心跳间隔
+  uint32_t last_seen;           // 最近一次心跳的tick
+  uint8_t armed;                // 首个心跳后才开始监控
+} WatchdogEntry_t;
+
+/* Private define ------------------------------------------------------------*/
+#define WATCHDOG_TASK_STACK_SIZE    TASK_STACK_SIZE_WATCHDOG
+#define WATCHDOG_TASK_PRIORITY      TASK_PRIORITY_WATCHDOG
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static TaskHandle_t xWatchdogTaskHandle = NULL;
+static StaticTask_t xWatchdogTaskTCB;
+static StackType_t xWatchdogTaskStack[WATCHDOG_TASK_STACK_SIZE];
+
+/* 心跳事件组: 每个任务每周期置一位, 监控端读取并清零 */
+static EventGroupHandle_t xHeartbeatGroup = NULL;
+static StaticEventGroup_t xHeartbeatGroupBuffer;
+
+static IWDG_HandleTypeDef hiwdg;
+static WatchdogStats_t xWatchdogStats = {0};
+
+/* 监控表: 截止期由main.h中的任务速率推导 (见watchdog.h). 任务在发出
+ * 首个心跳前不参与判定, 尚未创建的任务不会误触发 */
+static WatchdogEntry_t xMonitorTable[] = {
+  {WATCHDOG_BIT_SENSOR,    WATCHDOG_DEADLINE_SENSOR_MS,    0, 0},
+  {WATCHDOG_BIT_FUSION,    WATCHDOG_DEADLINE_FUSION_MS,    0, 0},
+  {WATCHDOG_BIT_CONTROL,   WATCHDOG_DEADLINE_CONTROL_MS,   0, 0},
+  {WATCHDOG_BIT_TELEMETRY, WATCHDOG_DEADLINE_TELEMETRY_MS, 0, 0},
+};
+#define WATCHDOG_ENTRY_COUNT  (sizeof(xMonitorTable) / sizeof(xMonitorTable[0]))
+
+/* Private function prototypes -----------------------------------------------*/
+static void WatchdogTask(void *pvParameters);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Create the watchdog supervision task
+ * @retval BaseType_t
+ */
+BaseType_t Watchdog_CreateTask(void)
+{
+  xHeartbeatGroup = xEventGroupCreateStatic(&xHeartbeatGroupBuffer);
+  if (xHeartbeatGroup == NULL) {
+    return pdFAIL;
+  }
+
+  xWatchdogTaskHandle = xTaskCreateStatic(WatchdogTask,
+                                          "Watchdog",
+                                          WATCHDOG_TASK_STACK_SIZE,
+                                          NULL,
+                                          WATCHDOG_TASK_PRIORITY,
+                                          xWatchdogTaskStack,
+                                          &xWatchdogTaskTCB);
+  return (xWatchdogTaskHandle != NULL) ? pdPASS : pdFAIL;
+}
+
+/**
+ * @brief  Heartbeat - monitored tasks call this once per cycle
+ * @param  bit: the caller's WATCHDOG_BIT_xxx
+ * @retval None
+ */
+void Watchdog_TaskAlive(uint32_t bit)
+{
+  if (xHeartbeatGroup != NULL) {
+    xEventGroupSetBits(xHeartbeatGroup, (EventBits_t)bit);
+  }
+}
+
+/**
+ * @brief  看门狗监控任务主函数
+ * @param  pvParameters: 任务参数
+ * @retval None
+ */
+static void WatchdogTask(void *pvParameters)
+{
+  EventBits_t bits;
+  uint32_t now;
+  uint8_t stalled = 0;
+
+  /* 上电后先恢复前一次IWDG复位的肇事记录 (RTC备份寄存器掉电保持) */
+  if (__HAL_RCC_GET_FLAG(RCC_FLAG_IWDGRST)) {
+    xWatchdogStats.recovered_bits = HAL_RTCEx_BKUPRead(&hrtc, RTC_BKP_DR0);
+    Log_Write(LOG_ID_WATCHDOG_RESET_RECOVERY, xWatchdogStats.recovered_bits,
+              HAL_RTCEx_BKUPRead(&hrtc, RTC_BKP_DR1));
+    HAL_RTCEx_BKUPWrite(&hrtc, RTC_BKP_DR0, 0);
+    __HAL_RCC_CLEAR_RESET_FLAGS();
+  }
+
+  /* 启动硬件IWDG - 从这里开始必须周期性喂狗, 否则~4.1s后复位 */
+  hiwdg.Instance = IWDG;
+  hiwdg.Init.Prescaler = WATCHDOG_IWDG_PRESCALER;
+  hiwdg.Init.Reload = WATCHDOG_IWDG_RELOAD;
+  hiwdg.Init.Window = IWDG_WINDOW_DISABLE;
+  if (HAL_IWDG_Init(&hiwdg) != HAL_OK) {
+    Error_Handler();
+  }
+
+  now = xTaskGetTickCount();
+  for (uint32_t i = 0; i < WATCHDOG_ENTRY_COUNT; i++) {
+    xMonitorTable[i].last_seen = now;
+  }
+
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(WATCHDOG_CHECK_PERIOD_MS));
+
+    /* 读取并清零本周期的心跳位 */
+    bits = xEventGroupClearBits(xHeartbeatGroup, WATCHDOG_BIT_ALL);
+    now = xTaskGetTickCount();
+    xWatchdogStats.check_cycles++;
+
+    for (uint32_t i = 0; i < WATCHDOG_ENTRY_COUNT; i++) {
+      WatchdogEntry_t *entry = &xMonitorTable[i];
+
+      if (bits & entry->bit) {
+        entry->last_seen = now;
+        entry->armed = 1;
+      } else if (entry->armed &&
+                 (now - entry->last_seen) > entry->deadline_ms &&
+                 (xWatchdogStats.last_missed_bits & entry->bit) == 0) {
+        /* 截止期超限: 记录肇事任务并锁入备份寄存器, 之后停止喂狗,
+         * 由IWDG完成恢复复位. 4秒余量足够日志DMA排空 */
+        xWatchdogStats.missed_deadlines++;
+        xWatchdogStats.last_missed_bits |= entry->bit;
+        Log_Write(LOG_ID_WATCHDOG_TASK_STALLED, entry->bit,
+                  now - entry->last_seen);
+        HAL_RTCEx_BKUPWrite(&hrtc, RTC_BKP_DR0,
+                            xWatchdogStats.last_missed_bits);
+        HAL_RTCEx_BKUPWrite(&hrtc, RTC_BKP_DR1, now);
+        stalled = 1;
+      }
+    }
+
+    if (!stalled) {
+      HAL_IWDG_Refresh(&hiwdg);
+      xWatchdogStats.iwdg_kicks++;
+    }
+  }
+}
+
+/**
+ * @brief  Get watchdog statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Watchdog_GetStats(WatchdogStats_t *stats)
+{
+  if (stats != NULL) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &xWatchdogStats, sizeof(WatchdogStats_t));
+    taskEXIT_CRITICAL();
+  }
+}
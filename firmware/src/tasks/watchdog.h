@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file           : watchdog.h
+ * @brief          : Event-group watchdog task header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Per-task liveness supervision over one FreeRTOS event
+ *                   group plus the hardware IWDG
+ *                  - Each monitored task sets its heartbeat bit once per
+ *                    cycle (a single event-group set, cheap enough for the
+ *                    100Hz acquisition path)
+ *                  - The watchdog task checks per-task deadlines derived
+ *                    from the rates in main.h and kicks the IWDG only while
+ *                    every armed task is on schedule
+ *                  - A missed deadline is logged and latched into an RTC
+ *                    backup register, then the IWDG is left to expire; the
+ *                    culprit is recovered from the backup register after
+ *                    the reset
+ ******************************************************************************
+ */
+
+#ifndef __WATCHDOG_H
+#define __WATCHDOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sensor_acq.h"
+#include "FreeRTOS.h"
+#include "event_groups.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Watchdog statistics */
+typedef struct {
+  uint32_t check_cycles;        // Supervision passes completed
+  uint32_t iwdg_kicks;          // Hardware watchdog refreshes
+  uint32_t missed_deadlines;    // Deadline violations detected
+  uint32_t last_missed_bits;    // Heartbeat bits that missed (accumulated)
+  uint32_t recovered_bits;      // Culprit bits read back after an IWDG reset
+} WatchdogStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Heartbeat bits - one per monitored task */
+#define WATCHDOG_BIT_SENSOR         (1UL << 0)
+#define WATCHDOG_BIT_FUSION         (1UL << 1)
+#define WATCHDOG_BIT_CONTROL        (1UL << 2)
+#define WATCHDOG_BIT_TELEMETRY      (1UL << 3)
+#define WATCHDOG_BIT_ALL            (WATCHDOG_BIT_SENSOR | WATCHDOG_BIT_FUSION | \
+                                     WATCHDOG_BIT_CONTROL | WATCHDOG_BIT_TELEMETRY)
+
+/* Supervision pass period */
+#define WATCHDOG_CHECK_PERIOD_MS    100
+
+/* Per-task heartbeat deadlines. Baseline is a handful of nominal periods
+ * from main.h; the sensor-driven tasks additionally tolerate the 1s
+ * keep-alive cadence of the adaptive idle mode (SENSOR_IDLE_PERIOD_MS),
+ * during which the whole pipeline legitimately slows to ~1Hz. */
+#define WATCHDOG_DEADLINE_SENSOR_MS    (3 * SENSOR_IDLE_PERIOD_MS + \
+                                        10 * (1000 / SENSOR_SAMPLE_RATE_HZ))
+#define WATCHDOG_DEADLINE_FUSION_MS    (3 * SENSOR_IDLE_PERIOD_MS + \
+                                        10 * (1000 / FUSION_UPDATE_RATE_HZ))
+#define WATCHDOG_DEADLINE_CONTROL_MS   (3 * SENSOR_IDLE_PERIOD_MS + \
+                                        10 * (1000 / SENSOR_SAMPLE_RATE_HZ))
+#define WATCHDOG_DEADLINE_TELEMETRY_MS (3 * SENSOR_IDLE_PERIOD_MS + \
+                                        10 * (1000 / TELEMETRY_RATE_HZ))
+
+/* IWDG: LSI/64 = 500Hz count rate, reload 2047 -> ~4.1s hardware timeout,
+ * an order of magnitude above the supervision period */
+#define WATCHDOG_IWDG_PRESCALER     IWDG_PRESCALER_64
+#define WATCHDOG_IWDG_RELOAD        2047
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Create the watchdog supervision task
+ * @retval BaseType_t
+ */
+BaseType_t Watchdog_CreateTask(void);
+
+/**
+ * @brief  Heartbeat - monitored tasks call this once per cycle
+ * @param  bit: the caller's WATCHDOG_BIT_xxx
+ * @retval None
+ */
+void Watchdog_TaskAlive(uint32_t bit);
+
+/**
+ * @brief  Get watchdog statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void Watchdog_GetStats(WatchdogStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __WATCHDOG_H */
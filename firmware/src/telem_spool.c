@@ -0,0 +1,317 @@
+/**
+ ******************************************************************************
+ * @file           : telem_spool.c
+ * @brief          : Flash-backed telemetry spool implementation
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Circular append-only frame spool in the top 64KB of
+ *                   flash bank 2. All writes are sequential doubleword
+ *                   programs; a page is erased exactly once per lap right
+ *                   before its first slot is written, so wear is spread
+ *                   evenly and no page sees more than one erase per full
+ *                   spool cycle. Code runs from bank 1, so bank-2 program
+ *                   and erase never stall instruction fetch.
+ *
+ *                   All calls are made from the telemetry task only; the
+ *                   module is deliberately lock-free.
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "telem_spool.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Slot field offsets */
+#define SPOOL_OFFSET_STATUS         8
+#define SPOOL_OFFSET_PAYLOAD        16
+
+/* Private macro -------------------------------------------------------------*/
+#define SPOOL_SLOT_ADDR(i)          (SPOOL_FLASH_BASE + (uint32_t)(i) * SPOOL_SLOT_SIZE)
+
+/* Private variables ---------------------------------------------------------*/
+static uint16_t usHeadSlot = 0;     // Next slot to write
+static uint16_t usTailSlot = 0;     // Oldest unconsumed slot
+static uint32_t ulPending = 0;      // Unconsumed frame count
+static uint32_t ulSequence = 0;     // Next append sequence number
+static TelemSpoolStats_t xSpoolStats = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef TelemSpool_ErasePage(uint16_t slot);
+static HAL_StatusTypeDef TelemSpool_ProgramSlot(uint16_t slot,
+                                                const uint8_t *frame,
+                                                uint16_t length);
+static uint8_t TelemSpool_SlotUnconsumed(uint16_t slot, uint32_t *sequence);
+
+/* Private user code ---------------------------------------------------------*/
+
+/**
+ * @brief  Initialize the spool (scan flash for the current head/tail)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef TelemSpool_Init(void)
+{
+  uint32_t sequence;
+  uint32_t max_seq = 0, min_seq = UINT32_MAX;
+  uint16_t max_slot = 0, min_slot = 0;
+  uint8_t found = 0;
+
+  usHeadSlot = 0;
+  usTailSlot = 0;
+  ulPending = 0;
+
+  /* Rebuild head/tail from the slot headers left by the previous session */
+  for (uint16_t slot = 0; slot < SPOOL_SLOT_COUNT; slot++) {
+    if (TelemSpool_SlotUnconsumed(slot, &sequence)) {
+      ulPending++;
+      if (!found || sequence > max_seq) {
+        max_seq = sequence;
+        max_slot = slot;
+      }
+      if (!found || sequence < min_seq) {
+        min_seq = sequence;
+        min_slot = slot;
+      }
+      found = 1;
+    }
+  }
+
+  if (found) {
+    usHeadSlot = (uint16_t)((max_slot + 1) % SPOOL_SLOT_COUNT);
+    usTailSlot = min_slot;
+    ulSequence = max_seq + 1;
+  }
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Append one telemetry frame to the spool
+ * @param  frame: frame buffer
+ * @param  length: frame length in bytes (up to SPOOL_SLOT_PAYLOAD_MAX)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef TelemSpool_Append(const uint8_t *frame, uint16_t length)
+{
+  HAL_StatusTypeDef status;
+
+  if (frame == NULL || length == 0 || length > SPOOL_SLOT_PAYLOAD_MAX) {
+    return HAL_ERROR;
+  }
+
+  /* Entering a fresh page: erase it, evicting whatever it still holds */
+  if ((usHeadSlot % SPOOL_SLOTS_PER_PAGE) == 0) {
+    status = TelemSpool_ErasePage(usHeadSlot);
+    if (status != HAL_OK) {
+      xSpoolStats.write_errors++;
+      return status;
+    }
+  }
+
+  status = TelemSpool_ProgramSlot(usHeadSlot, frame, length);
+  if (status != HAL_OK) {
+    xSpoolStats.write_errors++;
+    return status;
+  }
+
+  usHeadSlot = (uint16_t)((usHeadSlot + 1) % SPOOL_SLOT_COUNT);
+  ulSequence++;
+  ulPending++;
+  xSpoolStats.frames_spooled++;
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Read the oldest unconsumed frame without consuming it
+ * @param  frame: output buffer (at least SPOOL_SLOT_PAYLOAD_MAX bytes)
+ * @param  length: returned frame length
+ * @retval HAL_StatusTypeDef - HAL_ERROR when the spool is empty
+ */
+HAL_StatusTypeDef TelemSpool_Peek(uint8_t *frame, uint16_t *length)
+{
+  const uint8_t *slot_data;
+  uint16_t slot_length;
+  uint32_t sequence;
+
+  if (frame == NULL || length == NULL || ulPending == 0) {
+    return HAL_ERROR;
+  }
+
+  /* Skip consumed/evicted slots left behind by wrap-around */
+  while (!TelemSpool_SlotUnconsumed(usTailSlot, &sequence)) {
+    usTailSlot = (uint16_t)((usTailSlot + 1) % SPOOL_SLOT_COUNT);
+    if (usTailSlot == usHeadSlot) {
+      ulPending = 0;
+      return HAL_ERROR;
+    }
+  }
+
+  slot_data = (const uint8_t *)SPOOL_SLOT_ADDR(usTailSlot);
+  slot_length = (uint16_t)(slot_data[2] | ((uint16_t)slot_data[3] << 8));
+  if (slot_length > SPOOL_SLOT_PAYLOAD_MAX) {
+    return HAL_ERROR;
+  }
+
+  memcpy(frame, &slot_data[SPOOL_OFFSET_PAYLOAD], slot_length);
+  *length = slot_length;
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Mark the oldest unconsumed frame as consumed
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef TelemSpool_Consume(void)
+{
+  HAL_StatusTypeDef status;
+
+  if (ulPending == 0) {
+    return HAL_ERROR;
+  }
+
+  /* Zero the status doubleword - each doubleword is programmed exactly
+   * once after erase, which the L4 flash ECC requires */
+  HAL_FLASH_Unlock();
+  status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD,
+                             SPOOL_SLOT_ADDR(usTailSlot) + SPOOL_OFFSET_STATUS,
+                             0ULL);
+  HAL_FLASH_Lock();
+
+  if (status != HAL_OK) {
+    xSpoolStats.write_errors++;
+    return status;
+  }
+
+  usTailSlot = (uint16_t)((usTailSlot + 1) % SPOOL_SLOT_COUNT);
+  ulPending--;
+  xSpoolStats.frames_drained++;
+
+  return HAL_OK;
+}
+
+/**
+ * @brief  Number of unconsumed frames in the spool
+ * @retval uint32_t
+ */
+uint32_t TelemSpool_PendingCount(void)
+{
+  return ulPending;
+}
+
+/**
+ * @brief  Get spool statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void TelemSpool_GetStats(TelemSpoolStats_t *stats)
+{
+  if (stats != NULL) {
+    memcpy(stats, &xSpoolStats, sizeof(TelemSpoolStats_t));
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Erase the page containing a slot, accounting evicted frames
+ * @param  slot: first slot of the page
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef TelemSpool_ErasePage(uint16_t slot)
+{
+  FLASH_EraseInitTypeDef erase = {0};
+  HAL_StatusTypeDef status;
+  uint32_t page_error = 0;
+  uint32_t sequence;
+
+  /* Unconsumed frames on this page are lost to the wrap - count them and
+   * move the tail out of the way */
+  for (uint16_t s = slot; s < slot + SPOOL_SLOTS_PER_PAGE; s++) {
+    if (TelemSpool_SlotUnconsumed(s, &sequence)) {
+      xSpoolStats.frames_evicted++;
+      ulPending--;
+    }
+  }
+  if (usTailSlot >= slot && usTailSlot < slot + SPOOL_SLOTS_PER_PAGE) {
+    usTailSlot = (uint16_t)((slot + SPOOL_SLOTS_PER_PAGE) % SPOOL_SLOT_COUNT);
+  }
+
+  erase.TypeErase = FLASH_TYPEERASE_PAGES;
+  erase.Banks = FLASH_BANK_2;
+  erase.Page = SPOOL_FIRST_PAGE + slot / SPOOL_SLOTS_PER_PAGE;
+  erase.NbPages = 1;
+
+  HAL_FLASH_Unlock();
+  status = HAL_FLASHEx_Erase(&erase, &page_error);
+  HAL_FLASH_Lock();
+
+  return status;
+}
+
+/**
+ * @brief  Program one slot: header doubleword then payload doublewords
+ * @param  slot: target slot index
+ * @param  frame: frame buffer
+ * @param  length: frame length in bytes
+ * @retval HAL_StatusTypeDef
+ */
+static HAL_StatusTypeDef TelemSpool_ProgramSlot(uint16_t slot,
+                                                const uint8_t *frame,
+                                                uint16_t length)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t addr = SPOOL_SLOT_ADDR(slot);
+  uint64_t header;
+  uint64_t chunk;
+
+  header = (uint64_t)SPOOL_SLOT_MAGIC |
+           ((uint64_t)length << 16) |
+           ((uint64_t)ulSequence << 32);
+
+  HAL_FLASH_Unlock();
+
+  status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, addr, header);
+
+  /* Payload in 8-byte chunks, trailing bytes padded with 0xFF */
+  for (uint16_t offset = 0; status == HAL_OK && offset < length; offset += 8) {
+    chunk = UINT64_MAX;
+    memcpy(&chunk, &frame[offset],
+           (length - offset >= 8) ? 8 : (length - offset));
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD,
+                               addr + SPOOL_OFFSET_PAYLOAD + offset, chunk);
+  }
+
+  HAL_FLASH_Lock();
+
+  return status;
+}
+
+/**
+ * @brief  Check whether a slot holds a valid unconsumed frame
+ * @param  slot: slot index
+ * @param  sequence: returned append sequence number
+ * @retval 1 if unconsumed, 0 otherwise
+ */
+static uint8_t TelemSpool_SlotUnconsumed(uint16_t slot, uint32_t *sequence)
+{
+  const uint8_t *data = (const uint8_t *)SPOOL_SLOT_ADDR(slot);
+  uint16_t magic = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+  const uint32_t *state = (const uint32_t *)&data[SPOOL_OFFSET_STATUS];
+
+  if (magic != SPOOL_SLOT_MAGIC) {
+    return 0;
+  }
+  if (state[0] == 0 && state[1] == 0) {
+    return 0;  // Status doubleword zeroed: consumed
+  }
+
+  *sequence = (uint32_t)(data[4] | ((uint32_t)data[5] << 8) |
+                         ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24));
+  return 1;
+}
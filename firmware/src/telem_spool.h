@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file           : telem_spool.h
+ * @brief          : Flash-backed telemetry spool header file
+ * @author         : Your Name
+ * @version        : V1.0.0
+ * @date           : 2025-11-07
+ ******************************************************************************
+ * @description    : Append-only telemetry frame spool in internal flash
+ *                  - Fixed-size slots, strictly sequential writes (wear
+ *                    friendly), circular wrap with oldest-first eviction
+ *                  - Lives in the last pages of flash bank 2 while code
+ *                    executes from bank 1, so programming never stalls
+ *                    instruction fetch (L4 dual-bank read-while-write)
+ *                  - Slot state is tracked with separately-programmed
+ *                    doublewords (ECC forbids reprogramming): header written
+ *                    on append, status word zeroed on consume
+ *                  - Background draining by the telemetry task on reconnect
+ ******************************************************************************
+ */
+
+#ifndef __TELEM_SPOOL_H
+#define __TELEM_SPOOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Spool statistics */
+typedef struct {
+  uint32_t frames_spooled;      // Frames appended to flash
+  uint32_t frames_drained;      // Frames replayed and consumed
+  uint32_t frames_evicted;      // Unconsumed frames lost to wrap-around
+  uint32_t write_errors;        // Flash program/erase failures
+} TelemSpoolStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+
+/* 64KB spool region at the top of flash bank 2 (1MB part, 2KB pages) */
+#define SPOOL_FLASH_BASE            0x080F0000UL
+#define SPOOL_FLASH_SIZE            0x00010000UL
+/* FLASH_EraseInitTypeDef.Page is bank-relative (0-255), so the offset
+ * is taken from the start of bank 2, not from FLASH_BASE */
+#define SPOOL_FIRST_PAGE            ((SPOOL_FLASH_BASE - FLASH_BASE - \
+                                      FLASH_BANK_SIZE) / FLASH_PAGE_SIZE)
+#define SPOOL_PAGE_COUNT            (SPOOL_FLASH_SIZE / FLASH_PAGE_SIZE)
+
+/* Slot layout: 8-byte header dw + 8-byte status dw + payload, 256B total */
+#define SPOOL_SLOT_SIZE             256
+#define SPOOL_SLOT_PAYLOAD_MAX      (SPOOL_SLOT_SIZE - 16)
+#define SPOOL_SLOT_COUNT            (SPOOL_FLASH_SIZE / SPOOL_SLOT_SIZE)
+#define SPOOL_SLOTS_PER_PAGE        (FLASH_PAGE_SIZE / SPOOL_SLOT_SIZE)
+
+#define SPOOL_SLOT_MAGIC            0x5053  // "SP"
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initialize the spool (scan flash for the current head/tail)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef TelemSpool_Init(void);
+
+/**
+ * @brief  Append one telemetry frame to the spool
+ * @param  frame: frame buffer
+ * @param  length: frame length in bytes (up to SPOOL_SLOT_PAYLOAD_MAX)
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef TelemSpool_Append(const uint8_t *frame, uint16_t length);
+
+/**
+ * @brief  Read the oldest unconsumed frame without consuming it
+ * @param  frame: output buffer (at least SPOOL_SLOT_PAYLOAD_MAX bytes)
+ * @param  length: returned frame length
+ * @retval HAL_StatusTypeDef - HAL_ERROR when the spool is empty
+ */
+HAL_StatusTypeDef TelemSpool_Peek(uint8_t *frame, uint16_t *length);
+
+/**
+ * @brief  Mark the oldest unconsumed frame as consumed
+ * @retval HAL_StatusTypeDef
+ */
+HAL_StatusTypeDef TelemSpool_Consume(void);
+
+/**
+ * @brief  Number of unconsumed frames in the spool
+ * @retval uint32_t
+ */
+uint32_t TelemSpool_PendingCount(void);
+
+/**
+ * @brief  Get spool statistics
+ * @param  stats: returned statistics
+ * @retval None
+ */
+void TelemSpool_GetStats(TelemSpoolStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TELEM_SPOOL_H */
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+STM32L475E-IoT01A1 SWO/ITM Trace Decoder
+
+Decodes the raw SWO byte stream produced by the firmware trace subsystem
+(firmware/src/itm_trace.h). Each event is a single 32-bit word on an ITM
+stimulus port: event ID in the top byte, 24-bit payload below. Ports map
+to subsystems (1=scheduler, 2=queues, 3=I2C, 4=sample pipeline) so traces
+can be filtered without touching the target.
+
+Capturing with OpenOCD (ST-LINK on-board probe, 80MHz core, 2MHz SWO):
+
+    openocd -f board/stm32l4discovery.cfg \
+        -c "tpiu config internal swo.bin uart off 80000000 2000000" \
+        -c "itm ports on"
+
+then decode the capture:
+
+    python itm_trace_decode.py --file swo.bin
+    python itm_trace_decode.py --file swo.bin --port 3     # I2C only
+
+Author: Your Name
+Version: V1.0.0
+Date: 2025-11-07
+"""
+
+import argparse
+import sys
+
+# Must match firmware/src/itm_trace.h
+PORT_NAMES = {
+    1: "SCHED",
+    2: "QUEUE",
+    3: "I2C",
+    4: "SAMPLE",
+}
+
+EVENT_NAMES = {
+    0x01: ("TASK_IN",         "task #{payload}"),
+    0x02: ("QUEUE_SEND",      "queue #{payload}"),
+    0x03: ("QUEUE_RECV",      "queue #{payload}"),
+    0x04: ("QUEUE_SEND_FAIL", "queue #{payload}"),
+    0x05: ("I2C_START",       "device 0x{payload:02X}"),
+    0x06: ("I2C_DONE",        "status {payload}"),
+    0x07: ("SAMPLE_START",    "tick {payload}"),
+    0x08: ("SAMPLE_DONE",     "tick {payload}"),
+}
+
+# ITM SWIT header size field -> payload byte count
+SWIT_SIZES = {1: 1, 2: 2, 3: 4}
+
+
+class ITMDecoder:
+    """Streaming decoder for the ITM packet protocol (SWIT + housekeeping)"""
+
+    def __init__(self):
+        self.events = 0
+        self.skipped = 0
+
+    def decode(self, data):
+        """Yield (port, word) tuples for every instrumentation packet"""
+        i = 0
+        n = len(data)
+        while i < n:
+            header = data[i]
+
+            # Synchronization: a run of zero bytes terminated by 0x80
+            if header == 0x00:
+                i += 1
+                while i < n and data[i] == 0x00:
+                    i += 1
+                if i < n and data[i] == 0x80:
+                    i += 1
+                continue
+
+            # Overflow packet
+            if header == 0x70:
+                self.skipped += 1
+                i += 1
+                continue
+
+            size = header & 0x03
+            if size == 0:
+                # Protocol packet (timestamp/extension): bit7 of the header
+                # and of each payload byte marks a continuation byte
+                i += 1
+                if header & 0x80:
+                    while i < n:
+                        cont = data[i] & 0x80
+                        i += 1
+                        if not cont:
+                            break
+                self.skipped += 1
+                continue
+
+            # Software instrumentation packet (SWIT)
+            port = header >> 3
+            length = SWIT_SIZES[size]
+            if i + 1 + length > n:
+                break  # truncated tail
+            word = int.from_bytes(data[i + 1:i + 1 + length], "little")
+            i += 1 + length
+            self.events += 1
+            yield port, word
+
+
+def format_event(port, word):
+    """Render one trace word the way the firmware encoded it"""
+    evt = word >> 24
+    payload = word & 0x00FFFFFF
+    port_name = PORT_NAMES.get(port, f"port{port}")
+    name, template = EVENT_NAMES.get(
+        evt, (f"EVT_{evt:02X}", "payload 0x{payload:06X}"))
+    return f"[{port_name:6s}] {name:15s} {template.format(payload=payload)}"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="STM32L475E-IoT01A1 SWO/ITM trace decoder")
+    parser.add_argument("--file", required=True,
+                        help="raw SWO capture file (OpenOCD tpiu internal)")
+    parser.add_argument("--port", type=int, default=None,
+                        help="only show events from this stimulus port")
+    args = parser.parse_args()
+
+    decoder = ITMDecoder()
+    with open(args.file, "rb") as f:
+        data = f.read()
+
+    for port, word in decoder.decode(data):
+        if args.port is not None and port != args.port:
+            continue
+        print(format_event(port, word))
+
+    print(f"--- {decoder.events} events decoded, "
+          f"{decoder.skipped} housekeeping packets skipped ---",
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+STM32L475E-IoT01A1 Binary Log Decoder
+
+Decodes the deferred-format binary log records streamed over UART by the
+firmware logging subsystem (firmware/src/fastlog.c). Records are fixed-size
+16-byte little-endian frames; formatting happens here on the host so that
+one log call on target costs microseconds instead of milliseconds.
+
+Usage:
+    python log_decoder.py --serial COM3              # live decode
+    python log_decoder.py --file capture.bin         # decode a capture
+
+Author: Your Name
+Version: V1.0.0
+Date: 2025-11-07
+"""
+
+import argparse
+import struct
+import sys
+
+# Must match LogRecord_t in firmware/src/fastlog.h
+RECORD_MAGIC = 0x5AA5
+RECORD_SIZE = 16
+RECORD_FORMAT = "<HHIII"  # magic, id, timestamp, arg0, arg1
+
+# Must match LogId_t in firmware/src/fastlog.h
+LOG_MESSAGES = {
+    1:  ("SENSOR_INIT_FAILED",        "[SensorAcq] LSM6DSL initialization failed (status={arg0})"),
+    2:  ("SENSOR_INT1_CONFIG_FAILED", "[SensorAcq] LSM6DSL INT1 configuration failed (status={arg0})"),
+    3:  ("SENSOR_TASK_CREATED",       "[SensorAcq] SensorAcq task created successfully"),
+    4:  ("SENSOR_TASK_CREATE_FAILED", "[SensorAcq] Failed to create SensorAcq task"),
+    5:  ("SENSOR_TASK_STARTED",       "[SensorAcq] SensorAcq task started"),
+    6:  ("SENSOR_QUEUE_SEND_FAILED",  "[SensorAcq] Failed to send sensor data to queue (errors={arg0})"),
+    7:  ("SENSOR_MAX_RETRIES",        "[SensorAcq] Max sensor read retries exceeded (errors={arg0})"),
+    8:  ("SENSOR_REINIT_OK",          "[SensorAcq] Sensor reinitialized successfully"),
+    9:  ("SENSOR_ENABLED",            "[SensorAcq] Sensor acquisition enabled"),
+    10: ("SENSOR_DISABLED",           "[SensorAcq] Sensor acquisition disabled"),
+    11: ("SENSOR_IDLE_ENTER",         "[SensorAcq] Still for {arg0}ms, dropping to low-rate idle"),
+    12: ("SENSOR_WAKE_MOTION",        "[SensorAcq] Motion wake-up (WAKE_UP_SRC=0x{arg0:02X}), full rate restored"),
+    13: ("ENV_INIT_FAILED",           "[SensorAcq] Environmental sensor init failed (0=LPS22HB, 1=HTS221: {arg0})"),
+    14: ("ENV_READ_FAILED",           "[SensorAcq] Environmental sensor read failed (status={arg0})"),
+    15: ("LOG_OVERFLOW",              "[Log] Log ring overflow, {arg0} records dropped"),
+    16: ("LATENCY_STATS",             None),  # packed fields, see format_record
+    17: ("WATCHDOG_TASK_STALLED",     "[Watchdog] Heartbeat bit 0x{arg0:x} stalled, last seen {arg1}ms ago"),
+    18: ("WATCHDOG_RESET_RECOVERY",   "[Watchdog] Recovered from IWDG reset, culprit bits 0x{arg0:x} at tick {arg1}"),
+    19: ("BOOT_FIRST_SAMPLE",         "[Boot] First valid sample {arg0}ms after scheduler start"),
+    20: ("CONTROL_DEADLINE_MISS",     "[Control] End-to-end deadline missed: {arg0}ms (miss #{arg1})"),
+    21: ("REPLAY_CAPTURE_ACCEL",      None),  # packed int16 triple, see format_record
+    22: ("REPLAY_CAPTURE_GYRO",       None),  # packed int16 triple, see format_record
+    23: ("REPLAY_PASS_COMPLETE",      "[Replay] Dataset pass complete: {arg0} samples in {arg1}ms"),
+    24: ("PROFILING_SNAPSHOT_FAILED", "[Profiling] Task snapshot failed: capacity {arg0} < {arg1} tasks, CPU usage stuck at 0%"),
+}
+
+# Must match LatStage_t in firmware/src/latency.h
+LATENCY_STAGES = {
+    0: "acquisition",
+    1: "fusion",
+    2: "telemetry",
+    3: "publish",
+}
+
+
+def unpack_i16(value):
+    """Reinterpret a 16-bit field as a signed int16"""
+    value &= 0xFFFF
+    return value - 0x10000 if value & 0x8000 else value
+
+
+class LogDecoder:
+    def __init__(self):
+        self.buffer = b""
+        self.decoded_count = 0
+        self.resync_count = 0
+
+    def feed(self, data):
+        """Feed raw bytes, yield decoded records as formatted strings"""
+        self.buffer += data
+        while len(self.buffer) >= RECORD_SIZE:
+            magic, log_id, timestamp, arg0, arg1 = struct.unpack(
+                RECORD_FORMAT, self.buffer[:RECORD_SIZE])
+
+            if magic != RECORD_MAGIC:
+                # Resynchronize on the next magic candidate
+                offset = self.buffer.find(b"\xa5\x5a", 1)
+                self.buffer = self.buffer[offset:] if offset > 0 else b""
+                self.resync_count += 1
+                continue
+
+            self.buffer = self.buffer[RECORD_SIZE:]
+            self.decoded_count += 1
+            yield self.format_record(log_id, timestamp, arg0, arg1)
+
+    def format_record(self, log_id, timestamp, arg0, arg1):
+        """Format one record the way the old on-target printf logger did"""
+        name, template = LOG_MESSAGES.get(
+            log_id, ("UNKNOWN", "[?] Unknown log ID {id} (arg0={arg0}, arg1={arg1})"))
+        if name == "LATENCY_STATS":
+            # arg0 = stage (top byte) + p50 in us, arg1 = p99 in us
+            stage = LATENCY_STAGES.get(arg0 >> 24, f"stage{arg0 >> 24}")
+            message = (f"[Latency] {stage}: p50<{arg0 & 0x00FFFFFF}us "
+                       f"p99<{arg1}us")
+        elif name in ("REPLAY_CAPTURE_ACCEL", "REPLAY_CAPTURE_GYRO"):
+            # arg0 = x|y packed int16, arg1 = z | sequence<<16
+            x, y, z = (unpack_i16(arg0 & 0xFFFF), unpack_i16(arg0 >> 16),
+                       unpack_i16(arg1 & 0xFFFF))
+            axis = "accel" if name.endswith("ACCEL") else "gyro"
+            message = (f"[Capture] seq={arg1 >> 16} {axis}="
+                       f"({x}, {y}, {z})")
+        else:
+            message = template.format(id=log_id, arg0=arg0, arg1=arg1)
+        return f"{message} (Tick: {timestamp})"
+
+
+def decode_file(filename):
+    """Decode a binary log capture file"""
+    decoder = LogDecoder()
+    with open(filename, "rb") as f:
+        for line in decoder.feed(f.read()):
+            print(line)
+    print(f"--- {decoder.decoded_count} records decoded, "
+          f"{decoder.resync_count} resyncs ---", file=sys.stderr)
+
+
+def decode_serial(port, baudrate):
+    """Decode a live UART stream"""
+    import serial  # pyserial, see requirements.txt
+
+    decoder = LogDecoder()
+    print(f"Listening on {port} @ {baudrate} baud, Ctrl+C to stop...")
+    with serial.Serial(port, baudrate, timeout=1) as ser:
+        try:
+            while True:
+                data = ser.read(RECORD_SIZE)
+                for line in decoder.feed(data):
+                    print(line)
+        except KeyboardInterrupt:
+            print(f"\n--- {decoder.decoded_count} records decoded, "
+                  f"{decoder.resync_count} resyncs ---", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="STM32L475E-IoT01A1 binary log decoder")
+    parser.add_argument("--serial", help="serial port for live decoding (e.g. COM3)")
+    parser.add_argument("--baud", type=int, default=115200,
+                        help="serial baud rate (default: 115200)")
+    parser.add_argument("--file", help="decode a binary capture file instead")
+    args = parser.parse_args()
+
+    if args.file:
+        decode_file(args.file)
+    elif args.serial:
+        decode_serial(args.serial, args.baud)
+    else:
+        parser.print_help()
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
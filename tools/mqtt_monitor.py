@@ -2,402 +2,514 @@
 """
 STM32L475E-IoT01A1 MQTT Data Capture and Monitoring Tool
 
-Features:
-- Connect to HiveMQ broker and subscribe to sensor telemetry data
-- Real-time display of sensor data and system status
-- Log data to CSV files
-- Performance metrics monitoring and reporting
-- Data visualization
+Staged ingest pipeline sized for the batched binary telemetry frames
+(firmware/src/tasks/telemetry.h) at full rate from a fleet of devices:
+
+- The MQTT callback only timestamps the payload and drops it on a bounded
+  queue - no decode, no file I/O, no plotting on the network thread. A full
+  queue increments the device's drop counter instead of stalling the socket.
+- A decode worker drains the queue in batches, decodes binary frames (JSON
+  fallback kept for old firmware), tracks per-device sequence continuity
+  and feeds the CSV buffer and the plot ring.
+- CSV rows are buffered and written in batches, not flushed per record.
+- Plotting stores a decimated ring and redraws at a fixed rate on the main
+  thread, independent of the ingest rate.
+
+Per-device counters (messages, records, queue drops, decode errors, lost
+records from sequence gaps) make the monitor's numbers trustworthy during
+performance_test.py runs.
 
 Author: Your Name
-Version: V1.0.0
+Version: V2.0.0
 Date: 2025-11-07
 """
 
 import json
 import csv
+import struct
 import time
+import queue
 import threading
 import argparse
 from datetime import datetime
 from collections import deque
 import paho.mqtt.client as mqtt
 import matplotlib.pyplot as plt
-import matplotlib.animation as animation
-from matplotlib.dates import DateFormatter
-import numpy as np
+
+# Batched binary telemetry frame format - must match firmware/src/tasks/telemetry.h
+TELEM_FRAME_MAGIC = 0x544D
+TELEM_FRAME_VERSION = 1
+TELEM_FRAME_HEADER_SIZE = 16
+TELEM_RECORD_SIZE = 20
+
+# Fixed-point scale factors (int16 wire value -> engineering units)
+TELEM_SCALE_ACCEL = 100.0   # 0.01 m/s² per LSB
+TELEM_SCALE_GYRO = 1000.0   # 0.001 rad/s per LSB
+TELEM_SCALE_TEMP = 100.0    # 0.01 °C per LSB
+TELEM_SCALE_PRESS = 10.0    # 0.1 hPa per LSB
+TELEM_SCALE_HUM = 100.0     # 0.01 %RH per LSB
+
+# Ingest pipeline tuning
+INGEST_QUEUE_SIZE = 10000       # Raw messages buffered between callback and worker
+DECODE_BATCH_MAX = 256          # Messages decoded per worker wakeup
+CSV_FLUSH_ROWS = 1000           # Buffered rows per batched CSV write
+CSV_FLUSH_INTERVAL_S = 1.0      # ...or at least this often
+PLOT_RING_SIZE = 1000           # Points kept per plotted series
+PLOT_DECIMATE = 10              # Every Nth record enters the plot ring
+PLOT_REDRAW_INTERVAL_S = 0.5    # Plot redraw period (main thread)
+STATUS_INTERVAL_S = 2.0         # Console status line period
+
+CSV_FIELDS = [
+    'recv_time', 'device', 'timestamp', 'sequence',
+    'system_status', 'cpu_usage', 'free_heap',
+    'accel_x', 'accel_y', 'accel_z',
+    'gyro_x', 'gyro_y', 'gyro_z',
+    'pressure', 'temperature', 'humidity',
+    'data_valid'
+]
+
+
+def decode_telemetry_frame(payload):
+    """Decode one batched binary telemetry frame into a list of record
+    tuples matching CSV_FIELDS[2:], or None if the payload is not a binary
+    frame."""
+    if len(payload) < TELEM_FRAME_HEADER_SIZE:
+        return None
+
+    magic, version, record_count, base_timestamp, base_sequence, \
+        system_status, cpu_usage, free_heap = struct.unpack_from(
+            "<HBBIIBBH", payload, 0)
+    if magic != TELEM_FRAME_MAGIC or version != TELEM_FRAME_VERSION:
+        return None
+    if len(payload) < TELEM_FRAME_HEADER_SIZE + record_count * TELEM_RECORD_SIZE:
+        return None
+
+    records = []
+    timestamp = base_timestamp
+    for i in range(record_count):
+        offset = TELEM_FRAME_HEADER_SIZE + i * TELEM_RECORD_SIZE
+        dt_ms, flags, ax, ay, az, gx, gy, gz, temp, press, hum = \
+            struct.unpack_from("<BB9h", payload, offset)
+        timestamp += dt_ms
+        records.append((
+            timestamp, base_sequence + i,
+            system_status, float(cpu_usage), free_heap,
+            ax / TELEM_SCALE_ACCEL, ay / TELEM_SCALE_ACCEL, az / TELEM_SCALE_ACCEL,
+            gx / TELEM_SCALE_GYRO, gy / TELEM_SCALE_GYRO, gz / TELEM_SCALE_GYRO,
+            press / TELEM_SCALE_PRESS, temp / TELEM_SCALE_TEMP, hum / TELEM_SCALE_HUM,
+            flags & 0x01,
+        ))
+    return records
+
+
+def decode_json_record(payload):
+    """Legacy JSON message -> one record tuple (old firmware fallback)"""
+    data = json.loads(payload.decode('utf-8'))
+    sensor = data.get('sensor_data', {})
+    return [(
+        data.get('timestamp', 0), data.get('sequence', 0),
+        data.get('system_status', 0), data.get('cpu_usage', 0.0),
+        data.get('free_heap', 0),
+        sensor.get('accel_x', 0.0), sensor.get('accel_y', 0.0), sensor.get('accel_z', 0.0),
+        sensor.get('gyro_x', 0.0), sensor.get('gyro_y', 0.0), sensor.get('gyro_z', 0.0),
+        sensor.get('pressure', 0.0), sensor.get('temperature', 0.0), sensor.get('humidity', 0.0),
+        sensor.get('data_valid', 0),
+    )]
+
+
+class DeviceStats:
+    """Per-device ingest counters (one instance per topic)"""
+    __slots__ = ('messages', 'records', 'queue_drops', 'decode_errors',
+                 'lost_records', 'next_sequence', 'last_seen')
+
+    def __init__(self):
+        self.messages = 0
+        self.records = 0
+        self.queue_drops = 0
+        self.decode_errors = 0
+        self.lost_records = 0
+        self.next_sequence = None
+        self.last_seen = 0.0
+
 
 class STM32SensorMonitor:
-    def __init__(self, broker_host="broker.hivemq.com", broker_port=1883, 
-                 topic="stm32/sensor/telemetry"):
+    def __init__(self, broker_host="broker.hivemq.com", broker_port=1883,
+                 topic="sensors/telemetry/#", verbose=False):
         self.broker_host = broker_host
         self.broker_port = broker_port
         self.topic = topic
-        
-        # Data storage
-        self.sensor_data = deque(maxlen=1000)  # Recent 1000 data points
-        self.timestamps = deque(maxlen=1000)
-        self.accel_data = {'x': deque(maxlen=1000), 'y': deque(maxlen=1000), 'z': deque(maxlen=1000)}
-        self.gyro_data = {'x': deque(maxlen=1000), 'y': deque(maxlen=1000), 'z': deque(maxlen=1000)}
-        self.env_data = {'pressure': deque(maxlen=1000), 'temperature': deque(maxlen=1000), 'humidity': deque(maxlen=1000)}
-        
-        # Statistics
-        self.stats = {
-            'total_messages': 0,
-            'message_rate': 0.0,
-            'last_message_time': None,
-            'connection_status': 'Disconnected',
-            'data_loss_count': 0,
-            'avg_latency': 0.0
-        }
-        
+        self.verbose = verbose
+
+        # Ingest queue: MQTT callback -> decode worker. Bounded so a stalled
+        # decoder sheds load visibly (queue_drops) instead of growing without
+        # limit and hiding the problem.
+        self.ingest_queue = queue.Queue(maxsize=INGEST_QUEUE_SIZE)
+        self.decode_thread = None
+
+        # Per-device counters, keyed by topic
+        self.devices = {}
+        self.devices_lock = threading.Lock()
+        self.connection_status = 'Disconnected'
+
+        # Plot ring - decimated, bounded; fed by the worker, drawn by the
+        # main thread
+        self.plot_times = deque(maxlen=PLOT_RING_SIZE)
+        self.accel_data = {a: deque(maxlen=PLOT_RING_SIZE) for a in 'xyz'}
+        self.gyro_data = {a: deque(maxlen=PLOT_RING_SIZE) for a in 'xyz'}
+        self.env_data = {k: deque(maxlen=PLOT_RING_SIZE)
+                         for k in ('pressure', 'temperature', 'humidity')}
+        self.plot_decimate_count = 0
+
         # Control flags
         self.running = False
+
+        # Batched CSV output
         self.save_to_csv = False
         self.csv_filename = None
         self.csv_writer = None
         self.csv_file = None
-        
+        self.csv_rows = []
+        self.csv_last_flush = time.time()
+        self.csv_rows_written = 0
+
         # MQTT client
         self.mqtt_client = mqtt.Client()
         self.mqtt_client.on_connect = self.on_connect
         self.mqtt_client.on_message = self.on_message
         self.mqtt_client.on_disconnect = self.on_disconnect
-        
+
         # Visualization
         self.enable_plot = False
         self.fig = None
         self.axes = None
-        
+
+    def device(self, topic):
+        """Get (or create) the counters for one device topic"""
+        stats = self.devices.get(topic)
+        if stats is None:
+            with self.devices_lock:
+                stats = self.devices.setdefault(topic, DeviceStats())
+        return stats
+
     def on_connect(self, client, userdata, flags, rc):
         """MQTT connection callback"""
         if rc == 0:
             print(f"✓ Successfully connected to MQTT broker: {self.broker_host}:{self.broker_port}")
-            self.stats['connection_status'] = 'Connected'
+            self.connection_status = 'Connected'
             client.subscribe(self.topic)
             print(f"✓ Subscribed to topic: {self.topic}")
         else:
             print(f"✗ Connection failed, error code: {rc}")
-            self.stats['connection_status'] = 'Failed'
-    
+            self.connection_status = 'Failed'
+
     def on_disconnect(self, client, userdata, rc):
         """MQTT disconnection callback"""
         print(f"✗ Disconnected from MQTT broker, error code: {rc}")
-        self.stats['connection_status'] = 'Disconnected'
-    
+        self.connection_status = 'Disconnected'
+
     def on_message(self, client, userdata, msg):
-        """MQTT message receive callback"""
+        """MQTT message receive callback - enqueue only, never block.
+
+        Everything expensive (decode, CSV, plotting) happens off this
+        thread; dropping here is the explicit overload valve and is counted
+        per device."""
         try:
-            # Parse JSON data
-            payload = json.loads(msg.payload.decode('utf-8'))
-            current_time = time.time()
-            
-            # Update statistics
-            self.stats['total_messages'] += 1
-            self.stats['last_message_time'] = current_time
-            
-            # Calculate latency (if data contains timestamp)
-            if 'timestamp' in payload:
-                device_time = payload['timestamp'] / 1000.0  # Assume device timestamp is in milliseconds
-                latency = (current_time - device_time) if current_time > device_time else 0
-                self.stats['avg_latency'] = (self.stats['avg_latency'] * 0.9 + latency * 0.1)
-            
-            # Store data
-            self.store_sensor_data(payload, current_time)
-            
-            # Display real-time data
-            self.display_data(payload)
-            
-            # Save to CSV
-            if self.save_to_csv and self.csv_writer:
-                self.write_to_csv(payload, current_time)
-                
-        except json.JSONDecodeError as e:
-            print(f"✗ JSON parsing error: {e}")
-            self.stats['data_loss_count'] += 1
-        except Exception as e:
-            print(f"✗ Data processing error: {e}")
-            self.stats['data_loss_count'] += 1
-    
-    def store_sensor_data(self, data, timestamp):
-        """Store sensor data for visualization"""
-        self.timestamps.append(datetime.fromtimestamp(timestamp))
-        
-        # 存储加速度数据
-        if 'sensor_data' in data:
-            sensor = data['sensor_data']
-            self.accel_data['x'].append(sensor.get('accel_x', 0))
-            self.accel_data['y'].append(sensor.get('accel_y', 0))
-            self.accel_data['z'].append(sensor.get('accel_z', 0))
-            
-            self.gyro_data['x'].append(sensor.get('gyro_x', 0))
-            self.gyro_data['y'].append(sensor.get('gyro_y', 0))
-            self.gyro_data['z'].append(sensor.get('gyro_z', 0))
-            
-            self.env_data['pressure'].append(sensor.get('pressure', 0))
-            self.env_data['temperature'].append(sensor.get('temperature', 0))
-            self.env_data['humidity'].append(sensor.get('humidity', 0))
-    
-    def display_data(self, data):
-        """显示实时数据"""
-        print(f"\n=== 传感器数据 (序号: {data.get('sequence', 'N/A')}) ===")
-        print(f"时间戳: {data.get('timestamp', 'N/A')} ms")
-        print(f"系统状态: {data.get('system_status', 'N/A')}")
-        print(f"CPU使用率: {data.get('cpu_usage', 'N/A'):.1f}%")
-        print(f"空闲堆内存: {data.get('free_heap', 'N/A')} bytes")
-        
-        if 'sensor_data' in data:
-            sensor = data['sensor_data']
-            print(f"\n--- IMU数据 ---")
-            print(f"加速度: X={sensor.get('accel_x', 0):.3f}, Y={sensor.get('accel_y', 0):.3f}, Z={sensor.get('accel_z', 0):.3f} m/s²")
-            print(f"陀螺仪: X={sensor.get('gyro_x', 0):.3f}, Y={sensor.get('gyro_y', 0):.3f}, Z={sensor.get('gyro_z', 0):.3f} rad/s")
-            
-            print(f"\n--- 环境数据 ---")
-            print(f"气压: {sensor.get('pressure', 0):.2f} hPa")
-            print(f"温度: {sensor.get('temperature', 0):.1f} °C")
-            print(f"湿度: {sensor.get('humidity', 0):.1f} %RH")
-        
-        # 显示统计信息
-        rate = self.calculate_message_rate()
-        print(f"\n--- 统计信息 ---")
-        print(f"总消息数: {self.stats['total_messages']}")
-        print(f"消息速率: {rate:.1f} msg/s")
-        print(f"平均延迟: {self.stats['avg_latency']*1000:.1f} ms")
-        print(f"数据丢失: {self.stats['data_loss_count']}")
-        print("-" * 50)
-    
-    def calculate_message_rate(self):
-        """计算消息接收速率"""
-        current_time = time.time()
-        if len(self.timestamps) >= 2:
-            time_diff = (self.timestamps[-1] - self.timestamps[-10 if len(self.timestamps) >= 10 else 0]).total_seconds()
-            if time_diff > 0:
-                msg_count = min(10, len(self.timestamps))
-                return msg_count / time_diff
-        return 0.0
-    
+            self.ingest_queue.put_nowait((msg.topic, msg.payload, time.time()))
+        except queue.Full:
+            self.device(msg.topic).queue_drops += 1
+
+    def decode_worker(self):
+        """Decode worker: drain the ingest queue in batches"""
+        while self.running or not self.ingest_queue.empty():
+            try:
+                batch = [self.ingest_queue.get(timeout=0.2)]
+            except queue.Empty:
+                self.maybe_flush_csv()
+                continue
+            while len(batch) < DECODE_BATCH_MAX:
+                try:
+                    batch.append(self.ingest_queue.get_nowait())
+                except queue.Empty:
+                    break
+
+            for topic, payload, recv_time in batch:
+                self.process_message(topic, payload, recv_time)
+            self.maybe_flush_csv()
+
+    def process_message(self, topic, payload, recv_time):
+        """Decode one raw message and account it to its device"""
+        stats = self.device(topic)
+        stats.messages += 1
+        stats.last_seen = recv_time
+
+        records = decode_telemetry_frame(payload)
+        if records is None:
+            try:
+                records = decode_json_record(payload)
+            except Exception:
+                stats.decode_errors += 1
+                return
+
+        # Sequence continuity: the frame carries the sequence of its first
+        # record, so a gap is lost records attributable to this device
+        first_seq = records[0][1]
+        if stats.next_sequence is not None and first_seq > stats.next_sequence:
+            stats.lost_records += first_seq - stats.next_sequence
+        stats.next_sequence = records[-1][1] + 1
+        stats.records += len(records)
+
+        device_name = topic.rsplit('/', 1)[-1]
+        for record in records:
+            if self.save_to_csv:
+                self.csv_rows.append((recv_time, device_name) + record)
+
+            # Decimate into the plot ring - the plot is a health view, not
+            # an archive; the CSV has every record
+            self.plot_decimate_count += 1
+            if self.enable_plot and (self.plot_decimate_count % PLOT_DECIMATE) == 0:
+                self.plot_times.append(datetime.fromtimestamp(recv_time))
+                self.accel_data['x'].append(record[5])
+                self.accel_data['y'].append(record[6])
+                self.accel_data['z'].append(record[7])
+                self.gyro_data['x'].append(record[8])
+                self.gyro_data['y'].append(record[9])
+                self.gyro_data['z'].append(record[10])
+                self.env_data['pressure'].append(record[11])
+                self.env_data['temperature'].append(record[12])
+                self.env_data['humidity'].append(record[13])
+
     def setup_csv_logging(self, filename):
-        """设置CSV日志记录"""
+        """设置CSV日志记录 (批量缓冲写入)"""
         self.csv_filename = filename
         self.csv_file = open(filename, 'w', newline='', encoding='utf-8')
-        
-        fieldnames = [
-            'timestamp', 'sequence', 'system_status', 'cpu_usage', 'free_heap',
-            'accel_x', 'accel_y', 'accel_z',
-            'gyro_x', 'gyro_y', 'gyro_z',
-            'pressure', 'temperature', 'humidity',
-            'data_valid'
-        ]
-        
-        self.csv_writer = csv.DictWriter(self.csv_file, fieldnames=fieldnames)
-        self.csv_writer.writeheader()
+        self.csv_writer = csv.writer(self.csv_file)
+        self.csv_writer.writerow(CSV_FIELDS)
         self.save_to_csv = True
         print(f"✓ CSV日志已启用: {filename}")
-    
-    def write_to_csv(self, data, timestamp):
-        """写入数据到CSV文件"""
+
+    def maybe_flush_csv(self):
+        """批量写出缓冲的CSV行 (行数或时间阈值触发)"""
+        if not self.save_to_csv or not self.csv_rows:
+            return
+        now = time.time()
+        if (len(self.csv_rows) < CSV_FLUSH_ROWS and
+                now - self.csv_last_flush < CSV_FLUSH_INTERVAL_S):
+            return
         try:
-            sensor = data.get('sensor_data', {})
-            row = {
-                'timestamp': datetime.fromtimestamp(timestamp).isoformat(),
-                'sequence': data.get('sequence', ''),
-                'system_status': data.get('system_status', ''),
-                'cpu_usage': data.get('cpu_usage', ''),
-                'free_heap': data.get('free_heap', ''),
-                'accel_x': sensor.get('accel_x', ''),
-                'accel_y': sensor.get('accel_y', ''),
-                'accel_z': sensor.get('accel_z', ''),
-                'gyro_x': sensor.get('gyro_x', ''),
-                'gyro_y': sensor.get('gyro_y', ''),
-                'gyro_z': sensor.get('gyro_z', ''),
-                'pressure': sensor.get('pressure', ''),
-                'temperature': sensor.get('temperature', ''),
-                'humidity': sensor.get('humidity', ''),
-                'data_valid': sensor.get('data_valid', '')
-            }
-            self.csv_writer.writerow(row)
+            self.csv_writer.writerows(self.csv_rows)
             self.csv_file.flush()
+            self.csv_rows_written += len(self.csv_rows)
         except Exception as e:
             print(f"✗ CSV写入错误: {e}")
-    
+        self.csv_rows.clear()
+        self.csv_last_flush = now
+
     def setup_plot(self):
         """设置实时数据可视化"""
         self.enable_plot = True
         plt.ion()
-        
+
         self.fig, self.axes = plt.subplots(2, 2, figsize=(12, 8))
         self.fig.suptitle('STM32L475E 实时传感器数据监控')
-        
-        # 配置子图
-        self.axes[0, 0].set_title('加速度计 (m/s²)')
-        self.axes[0, 0].set_ylabel('加速度')
-        self.axes[0, 0].legend(['X', 'Y', 'Z'])
-        
-        self.axes[0, 1].set_title('陀螺仪 (rad/s)')
-        self.axes[0, 1].set_ylabel('角速度')
-        self.axes[0, 1].legend(['X', 'Y', 'Z'])
-        
-        self.axes[1, 0].set_title('环境传感器')
-        self.axes[1, 0].set_ylabel('压力 (hPa)')
-        
-        self.axes[1, 1].set_title('温湿度')
-        self.axes[1, 1].set_ylabel('温度 (°C) / 湿度 (%RH)')
-        
         plt.tight_layout()
-    
+
     def update_plot(self):
-        """更新可视化图表"""
-        if not self.enable_plot or len(self.timestamps) < 2:
+        """更新可视化图表 (主线程, 固定重绘周期, 数据已抽取)"""
+        if not self.enable_plot or len(self.plot_times) < 2:
             return
-            
+
         try:
-            # 清除之前的图
             for ax in self.axes.flat:
                 ax.clear()
-            
-            times = list(self.timestamps)
-            
-            # 加速度计数据
-            self.axes[0, 0].plot(times, list(self.accel_data['x']), 'r-', label='X')
-            self.axes[0, 0].plot(times, list(self.accel_data['y']), 'g-', label='Y')
-            self.axes[0, 0].plot(times, list(self.accel_data['z']), 'b-', label='Z')
+
+            times = list(self.plot_times)
+            n = len(times)
+
+            self.axes[0, 0].plot(times, list(self.accel_data['x'])[-n:], 'r-', label='X')
+            self.axes[0, 0].plot(times, list(self.accel_data['y'])[-n:], 'g-', label='Y')
+            self.axes[0, 0].plot(times, list(self.accel_data['z'])[-n:], 'b-', label='Z')
             self.axes[0, 0].set_title('加速度计 (m/s²)')
             self.axes[0, 0].legend()
             self.axes[0, 0].grid(True)
-            
-            # 陀螺仪数据
-            self.axes[0, 1].plot(times, list(self.gyro_data['x']), 'r-', label='X')
-            self.axes[0, 1].plot(times, list(self.gyro_data['y']), 'g-', label='Y')
-            self.axes[0, 1].plot(times, list(self.gyro_data['z']), 'b-', label='Z')
+
+            self.axes[0, 1].plot(times, list(self.gyro_data['x'])[-n:], 'r-', label='X')
+            self.axes[0, 1].plot(times, list(self.gyro_data['y'])[-n:], 'g-', label='Y')
+            self.axes[0, 1].plot(times, list(self.gyro_data['z'])[-n:], 'b-', label='Z')
             self.axes[0, 1].set_title('陀螺仪 (rad/s)')
             self.axes[0, 1].legend()
             self.axes[0, 1].grid(True)
-            
-            # 压力数据
-            self.axes[1, 0].plot(times, list(self.env_data['pressure']), 'purple', label='压力')
+
+            self.axes[1, 0].plot(times, list(self.env_data['pressure'])[-n:], 'purple')
             self.axes[1, 0].set_title('气压 (hPa)')
             self.axes[1, 0].grid(True)
-            
-            # 温湿度数据
+
             ax_temp = self.axes[1, 1]
             ax_humi = ax_temp.twinx()
-            
-            line1 = ax_temp.plot(times, list(self.env_data['temperature']), 'red', label='温度')
-            line2 = ax_humi.plot(times, list(self.env_data['humidity']), 'blue', label='湿度')
-            
+            line1 = ax_temp.plot(times, list(self.env_data['temperature'])[-n:], 'red', label='温度')
+            line2 = ax_humi.plot(times, list(self.env_data['humidity'])[-n:], 'blue', label='湿度')
             ax_temp.set_ylabel('温度 (°C)', color='red')
             ax_humi.set_ylabel('湿度 (%RH)', color='blue')
             ax_temp.set_title('温湿度')
-            
-            # 组合图例
             lines = line1 + line2
-            labels = [l.get_label() for l in lines]
-            ax_temp.legend(lines, labels, loc='upper left')
-            
+            ax_temp.legend(lines, [l.get_label() for l in lines], loc='upper left')
             ax_temp.grid(True)
-            
+
             plt.tight_layout()
             plt.draw()
             plt.pause(0.01)
-            
+
         except Exception as e:
             print(f"✗ 图表更新错误: {e}")
-    
+
+    def totals(self):
+        """Aggregate the per-device counters"""
+        agg = DeviceStats()
+        with self.devices_lock:
+            for stats in self.devices.values():
+                agg.messages += stats.messages
+                agg.records += stats.records
+                agg.queue_drops += stats.queue_drops
+                agg.decode_errors += stats.decode_errors
+                agg.lost_records += stats.lost_records
+        return agg
+
+    def print_status(self, prev_records, interval):
+        """周期状态行: 聚合速率 + 队列水位 (逐消息打印在高速率下即瓶颈)"""
+        agg = self.totals()
+        rate = (agg.records - prev_records) / interval if interval > 0 else 0.0
+        print(f"[{datetime.now().strftime('%H:%M:%S')}] "
+              f"devices={len(self.devices)} msgs={agg.messages} "
+              f"records={agg.records} rate={rate:.0f} rec/s "
+              f"queue={self.ingest_queue.qsize()}/{INGEST_QUEUE_SIZE} "
+              f"drops={agg.queue_drops} errors={agg.decode_errors} "
+              f"lost={agg.lost_records}")
+        if self.verbose:
+            with self.devices_lock:
+                for topic, stats in sorted(self.devices.items()):
+                    print(f"    {topic}: msgs={stats.messages} "
+                          f"records={stats.records} drops={stats.queue_drops} "
+                          f"errors={stats.decode_errors} lost={stats.lost_records}")
+        return agg.records
+
     def start(self):
         """启动监控"""
         self.running = True
         print(f"启动STM32传感器监控...")
         print(f"连接到: {self.broker_host}:{self.broker_port}")
         print(f"订阅主题: {self.topic}")
-        
+
+        # 解码工作线程先于网络回调就绪
+        self.decode_thread = threading.Thread(target=self.decode_worker,
+                                              name='decode', daemon=True)
+        self.decode_thread.start()
+
         # 连接MQTT代理
         try:
             self.mqtt_client.connect(self.broker_host, self.broker_port, 60)
             self.mqtt_client.loop_start()
         except Exception as e:
             print(f"✗ MQTT连接错误: {e}")
+            self.running = False
             return
-        
-        # 主循环
+
+        # 主循环: 状态行与图表重绘, 不碰数据路径
+        last_status = time.time()
+        last_redraw = last_status
+        prev_records = 0
         try:
             while self.running:
-                if self.enable_plot:
+                now = time.time()
+                if now - last_status >= STATUS_INTERVAL_S:
+                    prev_records = self.print_status(prev_records, now - last_status)
+                    last_status = now
+                if self.enable_plot and now - last_redraw >= PLOT_REDRAW_INTERVAL_S:
                     self.update_plot()
+                    last_redraw = now
                 time.sleep(0.1)
         except KeyboardInterrupt:
             print("\n收到中断信号，正在关闭...")
         finally:
             self.stop()
-    
+
     def stop(self):
         """停止监控"""
         print("正在停止监控...")
         self.running = False
-        
-        # 断开MQTT连接
+
+        # 断开MQTT连接 (停止入队), 再等工作线程排空队列
         self.mqtt_client.loop_stop()
         self.mqtt_client.disconnect()
-        
-        # 关闭CSV文件
+        if self.decode_thread is not None:
+            self.decode_thread.join(timeout=5)
+
+        # 写出剩余CSV缓冲并关闭
         if self.csv_file:
+            self.csv_last_flush = 0
+            self.maybe_flush_csv()
             self.csv_file.close()
-            print(f"✓ CSV文件已保存: {self.csv_filename}")
-        
+            print(f"✓ CSV文件已保存: {self.csv_filename} ({self.csv_rows_written} 行)")
+
         # 关闭图表
         if self.enable_plot:
             plt.close('all')
-        
+
         # 打印最终统计
         self.print_final_stats()
-    
+
     def print_final_stats(self):
-        """打印最终统计信息"""
+        """打印最终统计信息 (按设备)"""
+        agg = self.totals()
         print("\n=== 监控会话统计 ===")
-        print(f"总接收消息: {self.stats['total_messages']}")
-        print(f"数据丢失次数: {self.stats['data_loss_count']}")
-        print(f"平均延迟: {self.stats['avg_latency']*1000:.1f} ms")
-        if self.stats['total_messages'] > 0:
-            success_rate = (1 - self.stats['data_loss_count'] / self.stats['total_messages']) * 100
-            print(f"成功率: {success_rate:.1f}%")
+        print(f"设备数: {len(self.devices)}")
+        print(f"总接收消息: {agg.messages}")
+        print(f"总解码记录: {agg.records}")
+        print(f"队列丢弃: {agg.queue_drops}")
+        print(f"解码错误: {agg.decode_errors}")
+        print(f"序号缺口丢失: {agg.lost_records}")
+        with self.devices_lock:
+            for topic, stats in sorted(self.devices.items()):
+                print(f"  {topic}: msgs={stats.messages} records={stats.records} "
+                      f"drops={stats.queue_drops} errors={stats.decode_errors} "
+                      f"lost={stats.lost_records}")
         print("=" * 25)
 
 
 def main():
     """主函数"""
     parser = argparse.ArgumentParser(description='STM32L475E-IoT01A1 MQTT传感器监控工具')
-    parser.add_argument('--broker', default='broker.hivemq.com', 
+    parser.add_argument('--broker', default='broker.hivemq.com',
                        help='MQTT代理地址 (默认: broker.hivemq.com)')
-    parser.add_argument('--port', type=int, default=1883, 
+    parser.add_argument('--port', type=int, default=1883,
                        help='MQTT代理端口 (默认: 1883)')
-    parser.add_argument('--topic', default='stm32/sensor/telemetry', 
-                       help='MQTT主题 (默认: stm32/sensor/telemetry)')
-    parser.add_argument('--csv', type=str, 
-                       help='保存数据到CSV文件')
-    parser.add_argument('--plot', action='store_true', 
-                       help='启用实时数据可视化')
-    parser.add_argument('--verbose', '-v', action='store_true', 
-                       help='详细输出模式')
-    
+    parser.add_argument('--topic', default='sensors/telemetry/#',
+                       help='MQTT主题, 支持通配符订阅整个设备群 (默认: sensors/telemetry/#)')
+    parser.add_argument('--csv', type=str,
+                       help='保存数据到CSV文件 (批量缓冲写入)')
+    parser.add_argument('--plot', action='store_true',
+                       help='启用实时数据可视化 (抽取显示)')
+    parser.add_argument('--verbose', '-v', action='store_true',
+                       help='状态行附带按设备计数')
+
     args = parser.parse_args()
-    
+
     # 创建监控实例
-    monitor = STM32SensorMonitor(args.broker, args.port, args.topic)
-    
+    monitor = STM32SensorMonitor(args.broker, args.port, args.topic, args.verbose)
+
     # 配置CSV日志
     if args.csv:
         monitor.setup_csv_logging(args.csv)
-    
+
     # 配置可视化
     if args.plot:
         monitor.setup_plot()
-    
-    print("STM32L475E-IoT01A1 实时传感器监控工具 v1.0.0")
+
+    print("STM32L475E-IoT01A1 实时传感器监控工具 v2.0.0")
     print("按 Ctrl+C 退出")
     print("-" * 50)
-    
+
     # 启动监控
     monitor.start()
 
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
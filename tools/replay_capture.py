@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+STM32L475E-IoT01A1 Sensor Capture Extraction Tool
+
+Splits raw IMU capture records back out of a binary log stream
+(firmware/src/replay.c, SENSOR_CAPTURE_STREAM=1) and turns them into a
+replay dataset. Each sample is two 16-byte log records - accelerometer and
+gyroscope int16 triples sharing a sequence number - which this tool pairs
+back into complete frames.
+
+Usage:
+    python replay_capture.py --serial COM3 --out capture.bin   # record live
+    python replay_capture.py --file capture.bin --emit-c firmware/src/replay_data.c
+    python replay_capture.py --file capture.bin --csv capture.csv
+
+The generated replay_data.c overrides the weak built-in dataset and is
+linked into the replay firmware (python build.py replay).
+
+Author: Your Name
+Version: V1.0.0
+Date: 2025-11-07
+"""
+
+import argparse
+import struct
+import sys
+
+# Must match LogRecord_t in firmware/src/fastlog.h
+RECORD_MAGIC = 0x5AA5
+RECORD_SIZE = 16
+RECORD_FORMAT = "<HHIII"  # magic, id, timestamp, arg0, arg1
+
+# Must match LogId_t in firmware/src/fastlog.h
+LOG_ID_REPLAY_CAPTURE_ACCEL = 21
+LOG_ID_REPLAY_CAPTURE_GYRO = 22
+
+
+def unpack_i16(value):
+    """Reinterpret a 16-bit field as a signed int16"""
+    value &= 0xFFFF
+    return value - 0x10000 if value & 0x8000 else value
+
+
+def unpack_triple(arg0, arg1):
+    """Unpack (x|y, z|seq) into ((x, y, z), seq)"""
+    return ((unpack_i16(arg0), unpack_i16(arg0 >> 16), unpack_i16(arg1)),
+            (arg1 >> 16) & 0xFFFF)
+
+
+def extract_frames(data):
+    """Pair capture records from a binary log stream into complete frames.
+
+    Returns a list of (timestamp_ms, accel_xyz, gyro_xyz) tuples in capture
+    order. Frames whose accel or gyro half was lost to a log ring overflow
+    are dropped.
+    """
+    pending = {}  # seq -> (timestamp, accel)
+    frames = []
+    offset = 0
+    dropped = 0
+
+    while offset + RECORD_SIZE <= len(data):
+        magic, log_id, timestamp, arg0, arg1 = struct.unpack_from(
+            RECORD_FORMAT, data, offset)
+        if magic != RECORD_MAGIC:
+            # Resynchronize on the next magic candidate
+            next_magic = data.find(b"\xa5\x5a", offset + 1)
+            if next_magic < 0:
+                break
+            offset = next_magic
+            continue
+        offset += RECORD_SIZE
+
+        if log_id == LOG_ID_REPLAY_CAPTURE_ACCEL:
+            accel, seq = unpack_triple(arg0, arg1)
+            pending[seq] = (timestamp, accel)
+        elif log_id == LOG_ID_REPLAY_CAPTURE_GYRO:
+            gyro, seq = unpack_triple(arg0, arg1)
+            if seq in pending:
+                timestamp, accel = pending.pop(seq)
+                frames.append((timestamp, accel, gyro))
+            else:
+                dropped += 1
+
+    dropped += len(pending)
+    if dropped:
+        print(f"⚠️  {dropped} half-frames dropped (log ring overflow?)",
+              file=sys.stderr)
+    return frames
+
+
+def emit_c(frames, path):
+    """Write the dataset as a C source overriding the weak built-in table"""
+    with open(path, "w") as f:
+        f.write(
+            "/**\n"
+            " ******************************************************************************\n"
+            " * @file           : replay_data.c\n"
+            " * @brief          : Recorded replay dataset (generated file)\n"
+            " ******************************************************************************\n"
+            " * @description    : Generated by tools/replay_capture.py --emit-c from a\n"
+            " *                   binary log capture. Overrides the weak built-in\n"
+            " *                   dataset in replay.c. Do not edit by hand.\n"
+            " ******************************************************************************\n"
+            " */\n\n"
+            '#include "replay.h"\n\n'
+            f"const ReplayFrame_t g_xReplayDataset[{len(frames)}] = {{\n")
+        for _, accel, gyro in frames:
+            f.write(f"  {{ {{ {accel[0]:6d}, {accel[1]:6d}, {accel[2]:6d} }},"
+                    f" {{ {gyro[0]:6d}, {gyro[1]:6d}, {gyro[2]:6d} }} }},\n")
+        f.write("};\n\n"
+                "const uint32_t g_ulReplayDatasetCount =\n"
+                "    sizeof(g_xReplayDataset) / sizeof(g_xReplayDataset[0]);\n")
+    print(f"✅ {len(frames)} frames written to {path}")
+
+
+def emit_csv(frames, path):
+    """Write the dataset as CSV for host-side analysis"""
+    with open(path, "w") as f:
+        f.write("timestamp_ms,ax,ay,az,gx,gy,gz\n")
+        for timestamp, accel, gyro in frames:
+            f.write(f"{timestamp},{accel[0]},{accel[1]},{accel[2]},"
+                    f"{gyro[0]},{gyro[1]},{gyro[2]}\n")
+    print(f"✅ {len(frames)} frames written to {path}")
+
+
+def record_serial(port, baudrate, out_path, duration):
+    """Record the raw binary log stream to a capture file"""
+    import time
+
+    import serial  # pyserial, see requirements.txt
+
+    print(f"📡 Recording from {port} @ {baudrate} baud for {duration}s "
+          f"(Ctrl+C to stop early)...")
+    deadline = time.time() + duration
+    total = 0
+    with serial.Serial(port, baudrate, timeout=1) as ser, \
+            open(out_path, "wb") as f:
+        try:
+            while time.time() < deadline:
+                data = ser.read(4096)
+                if data:
+                    f.write(data)
+                    total += len(data)
+        except KeyboardInterrupt:
+            pass
+    print(f"✅ {total} bytes captured to {out_path}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="STM32L475E-IoT01A1 sensor capture extraction tool")
+    parser.add_argument("--serial", help="serial port to record from (e.g. COM3)")
+    parser.add_argument("--baud", type=int, default=115200,
+                        help="serial baud rate (default: 115200)")
+    parser.add_argument("--out", default="capture.bin",
+                        help="output file for --serial recording")
+    parser.add_argument("--duration", type=int, default=60,
+                        help="recording duration in seconds (default: 60)")
+    parser.add_argument("--file", help="binary log capture file to extract")
+    parser.add_argument("--emit-c", help="write the dataset as replay_data.c")
+    parser.add_argument("--csv", help="write the dataset as CSV")
+    args = parser.parse_args()
+
+    if args.serial:
+        record_serial(args.serial, args.baud, args.out, args.duration)
+        return
+
+    if not args.file:
+        parser.print_help()
+        sys.exit(1)
+
+    with open(args.file, "rb") as f:
+        frames = extract_frames(f.read())
+    if not frames:
+        print("❌ No capture frames found in the stream", file=sys.stderr)
+        sys.exit(1)
+
+    if args.emit_c:
+        emit_c(frames, args.emit_c)
+    if args.csv:
+        emit_csv(frames, args.csv)
+    if not args.emit_c and not args.csv:
+        print(f"ℹ️  {len(frames)} frames found; use --emit-c or --csv")
+
+
+if __name__ == "__main__":
+    main()